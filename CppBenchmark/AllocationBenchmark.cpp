@@ -0,0 +1,53 @@
+#include <memory>
+#include "Benchmark.h"
+
+/// <summary>
+/// Managed bytes allocated by one call of fn, averaged over iterations calls after one warm up call
+/// </summary>
+template <typename Fn>
+static double AllocatedBytesPerCall(size_t iterations, Fn&& fn)
+{
+	fn();
+
+	int64_t before = DataContainer::AllocatedBytes();
+
+	for (size_t i = 0; i < iterations; i++)
+	{
+		fn();
+	}
+
+	return static_cast<double>(DataContainer::AllocatedBytes() - before) / iterations;
+}
+
+/// <summary>
+/// Time and managed allocations of GetValue and SetValue for a primitive, a Point and a Color
+/// </summary>
+BENCHMARK(Allocation)
+{
+	const size_t iterations = 100000;
+
+	std::unique_ptr<DataContainer> dc(DataContainerBuilder::Create("Values")
+		->Data("Speed", 1.0)
+		->Data("Origin", Point{ 1, 2 })
+		->Data("Tint", Color{ 10, 20, 30 })
+		->Build());
+
+	double speed = 0;
+	Point origin{};
+	Color tint{};
+
+	auto report = [&](const char* name, auto call)
+	{
+		double bytes = AllocatedBytesPerCall(iterations, call);
+		double ns = NanosecondsPerCall(iterations, call);
+
+		std::printf("  %-20s %8.1f ns  %8.1f bytes\n", name, ns, bytes);
+	};
+
+	report("GetValue double", [&]() { dc->GetValue("Speed", speed); });
+	report("SetValue double", [&]() { dc->SetValue("Speed", ++speed); });
+	report("GetValue Point", [&]() { dc->GetValue("Origin", origin); });
+	report("SetValue Point", [&]() { origin.x++; dc->SetValue("Origin", origin); });
+	report("GetValue Color", [&]() { dc->GetValue("Tint", tint); });
+	report("SetValue Color", [&]() { tint.r++; dc->SetValue("Tint", tint); });
+}
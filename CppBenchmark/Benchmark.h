@@ -0,0 +1,99 @@
+#pragma once
+// Minimal timing harness, benchmarks register themselves with BENCHMARK and are run by CppBenchmark.cpp
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "..\DataContainer.CLR\DataContainerBuilder.h"
+
+struct BenchmarkCase
+{
+	const char* name;
+	void (*run)();
+};
+
+std::vector<BenchmarkCase>& Benchmarks();
+
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(const char* name, void (*run)())
+	{
+		Benchmarks().push_back(BenchmarkCase{ name, run });
+	}
+};
+
+#define BENCHMARK(_name)                                                   \
+static void _name();                                                       \
+static BenchmarkRegistrar _name##Registrar(#_name, &_name);                \
+static void _name()
+
+/// <summary>
+/// Seconds taken by one call of fn
+/// </summary>
+template <typename Fn>
+double Seconds(Fn&& fn)
+{
+	auto start = std::chrono::steady_clock::now();
+	fn();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// <summary>
+/// Average nanoseconds per call of fn over iterations calls, after one warm up call
+/// </summary>
+template <typename Fn>
+double NanosecondsPerCall(size_t iterations, Fn&& fn)
+{
+	fn();
+
+	double seconds = Seconds([&]()
+	{
+		for (size_t i = 0; i < iterations; i++)
+		{
+			fn();
+		}
+	});
+
+	return seconds * 1e9 / iterations;
+}
+
+inline double Megabytes(uintmax_t bytes)
+{
+	return bytes / (1024.0 * 1024.0);
+}
+
+/// <summary>
+/// Directory under the temp directory, removed with everything in it when destroyed
+/// </summary>
+class TempDirectory
+{
+public:
+	explicit TempDirectory(const std::string& name)
+		: path(std::filesystem::temp_directory_path() / "DataContainerBenchmark" / name)
+	{
+		std::filesystem::remove_all(path);
+		std::filesystem::create_directories(path);
+	}
+
+	~TempDirectory()
+	{
+		std::error_code ignored;
+		std::filesystem::remove_all(path, ignored);
+	}
+
+	TempDirectory(const TempDirectory&) = delete;
+	TempDirectory& operator=(const TempDirectory&) = delete;
+
+	std::string File(const std::string& name) const
+	{
+		return (path / name).string();
+	}
+
+	const std::filesystem::path path;
+};
+
+/// <summary>
+/// Container shaped like a machine configuration, devices each holding axes with a few typed settings
+/// </summary>
+DataContainer* BuildMachineConfig(int devices, int axes);
@@ -0,0 +1,44 @@
+#include <memory>
+#include "Benchmark.h"
+
+/// <summary>
+/// Size and load time of the same configuration saved as XML, binary and compressed binary
+/// </summary>
+BENCHMARK(CompressedBinary)
+{
+	const int runs = 10;
+	TempDirectory directory("CompressedBinary");
+
+	std::unique_ptr<DataContainer> config(BuildMachineConfig(200, 10));
+	std::string xml = directory.File("Machine.xml");
+	std::string binary = directory.File("Machine.bin");
+	std::string compressed = directory.File("Machine.dcz");
+
+	config->SaveAsXml(xml);
+	config->SaveAsBinary(binary);
+	config->SaveAsCompressedBinary(compressed);
+
+	uintmax_t xmlSize = std::filesystem::file_size(xml);
+
+	auto report = [&](const char* format, const std::string& path, auto load)
+	{
+		load();
+		double seconds = Seconds([&]()
+		{
+			for (int i = 0; i < runs; i++)
+			{
+				load();
+			}
+		}) / runs;
+
+		uintmax_t size = std::filesystem::file_size(path);
+		std::printf("  %-20s %8.2f MB  %5.1fx  %8.2f ms  %8.1f MB/s\n", format, Megabytes(size),
+			static_cast<double>(xmlSize) / size, seconds * 1e3, Megabytes(xmlSize) / seconds);
+	};
+
+	std::printf("  %-20s %11s  %6s  %11s  %13s\n", "", "size", "ratio", "load", "XML MB/s");
+	report("XML", xml, [&]() { DataContainer dc = DataContainer::LoadFromXml(xml); });
+	report("Binary", binary, [&]() { DataContainer dc = DataContainer::LoadFromBinary(binary); });
+	report("Compressed", compressed, [&]() { DataContainer dc = DataContainer::LoadFromCompressedBinary(compressed); });
+	report("Compressed, 1 key", compressed, [&]() { DataContainer dc = DataContainer::LoadFromCompressedBinary(compressed, { "Device100" }); });
+}
@@ -0,0 +1,57 @@
+// CppBenchmark.cpp : Runs benchmarks of the native API.
+// "CppBenchmark Query" only runs benchmarks with Query in their name.
+
+#include <cstring>
+#include "Benchmark.h"
+
+std::vector<BenchmarkCase>& Benchmarks()
+{
+	static std::vector<BenchmarkCase> benchmarks;
+	return benchmarks;
+}
+
+DataContainer* BuildMachineConfig(int devices, int axes)
+{
+	DataContainerBuilder* machine = DataContainerBuilder::Create("Machine");
+
+	for (int d = 0; d < devices; d++)
+	{
+		std::string name = "Device" + std::to_string(d);
+
+		DataContainerBuilder* device = DataContainerBuilder::Create(name)
+			->Data("Serial", "SN-" + std::to_string(100000 + d))
+			->Data("Firmware", "2.4.1")
+			->Data("Enabled", true);
+
+		for (int a = 0; a < axes; a++)
+		{
+			std::string axis = "Axis" + std::to_string(a);
+
+			device->SubDataContainer(axis, DataContainerBuilder::Create(axis)
+				->Data("Speed", 100.0 + a)
+				->Data("Acceleration", 2500.0)
+				->Data("Steps", static_cast<int32_t>(200 * (a + 1)))
+				->Data("Homed", false)
+				->Data("Unit", "mm"));
+		}
+
+		machine->SubDataContainer(name, device);
+	}
+
+	return machine->Build();
+}
+
+int main(int argc, char* argv[])
+{
+	const char* filter = argc > 1 ? argv[1] : "";
+
+	for (const BenchmarkCase& benchmark : Benchmarks())
+	{
+		if (std::strstr(benchmark.name, filter))
+		{
+			std::printf("%s\n", benchmark.name);
+			benchmark.run();
+			std::printf("\n");
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#include <memory>
+#include "Benchmark.h"
+
+/// <summary>
+/// Write and read throughput of JSON against XML on the same configuration
+/// </summary>
+BENCHMARK(Json)
+{
+	const int runs = 5;
+	TempDirectory directory("Json");
+
+	std::unique_ptr<DataContainer> config(BuildMachineConfig(2000, 10));
+	std::string xml = directory.File("Machine.xml");
+	std::string json = directory.File("Machine.json");
+
+	auto report = [&](const char* format, const std::string& path, auto save, auto load)
+	{
+		save();
+		load();
+
+		double write = Seconds([&]()
+		{
+			for (int i = 0; i < runs; i++)
+			{
+				save();
+			}
+		}) / runs;
+
+		double read = Seconds([&]()
+		{
+			for (int i = 0; i < runs; i++)
+			{
+				load();
+			}
+		}) / runs;
+
+		double gigabytes = std::filesystem::file_size(path) / (1024.0 * 1024.0 * 1024.0);
+		std::printf("  %-5s %8.2f MB  write %6.3f GB/s  read %6.3f GB/s\n", format, gigabytes * 1024, gigabytes / write, gigabytes / read);
+	};
+
+	report("XML", xml, [&]() { config->SaveAsXml(xml); }, [&]() { DataContainer dc = DataContainer::LoadFromXml(xml); });
+	report("JSON", json, [&]() { config->SaveAsJson(json); }, [&]() { DataContainer dc = DataContainer::LoadFromJson(json); });
+}
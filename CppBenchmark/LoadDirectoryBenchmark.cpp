@@ -0,0 +1,42 @@
+#include <memory>
+#include <thread>
+#include "Benchmark.h"
+
+/// <summary>
+/// 10k small files loaded one by one with LoadFromXml and in parallel with LoadDirectory
+/// </summary>
+BENCHMARK(LoadDirectory)
+{
+	const int files = 10000;
+	TempDirectory directory("LoadDirectory");
+
+	std::unique_ptr<DataContainer> device(BuildMachineConfig(1, 4));
+	std::string first = directory.File("Device0.xml");
+	device->SaveAsXml(first);
+
+	for (int i = 1; i < files; i++)
+	{
+		std::filesystem::copy_file(first, directory.File("Device" + std::to_string(i) + ".xml"));
+	}
+
+	double serial = Seconds([&]()
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(directory.path))
+		{
+			DataContainer dc = DataContainer::LoadFromXml(entry.path().string());
+		}
+	});
+
+	std::vector<LoadError> errors;
+	size_t loaded = 0;
+
+	double parallel = Seconds([&]()
+	{
+		DataContainer dc = DataContainer::LoadDirectory(directory.path.string(), "*.xml", errors);
+		loaded = dc.GetKeys().size();
+	});
+
+	std::printf("  %d files, %u cores\n", files, std::thread::hardware_concurrency());
+	std::printf("  LoadFromXml one by one %10.0f files/s\n", files / serial);
+	std::printf("  LoadDirectory          %10.0f files/s  %.1fx  %zu loaded  %zu errors\n", files / parallel, serial / parallel, loaded, errors.size());
+}
@@ -0,0 +1,58 @@
+#include <memory>
+#include "Benchmark.h"
+
+/// <summary>
+/// Container with the key "Level1.Level2...Value" that has depth segments, every level also holds a few siblings
+/// </summary>
+static DataContainer* BuildNested(int depth, std::string& key)
+{
+	DataContainerBuilder* level = nullptr;
+	key = "Value";
+
+	for (int d = depth - 1; d >= 0; d--)
+	{
+		std::string name = d == 0 ? "Root" : "Level" + std::to_string(d);
+		DataContainerBuilder* parent = DataContainerBuilder::Create(name);
+
+		for (int s = 0; s < 8; s++)
+		{
+			parent->Data("Sibling" + std::to_string(s), static_cast<int32_t>(s));
+		}
+
+		if (level)
+		{
+			parent->SubDataContainer("Level" + std::to_string(d + 1), level);
+			key = "Level" + std::to_string(d + 1) + "." + key;
+		}
+		else
+		{
+			parent->Data("Value", 1.0);
+		}
+
+		level = parent;
+	}
+
+	return level->Build();
+}
+
+/// <summary>
+/// GetValue and SetValue of a double through keys with 1 to 16 segments
+/// </summary>
+BENCHMARK(PathIndex)
+{
+	const size_t iterations = 200000;
+
+	std::printf("  %5s  %12s  %12s\n", "depth", "GetValue", "SetValue");
+
+	for (int depth = 1; depth <= 16; depth++)
+	{
+		std::string key;
+		std::unique_ptr<DataContainer> dc(BuildNested(depth, key));
+
+		double value = 0;
+		double get = NanosecondsPerCall(iterations, [&]() { dc->GetValue(key, value); });
+		double set = NanosecondsPerCall(iterations, [&]() { dc->SetValue(key, ++value); });
+
+		std::printf("  %5d  %9.0f ns  %9.0f ns\n", depth, get, set);
+	}
+}
@@ -0,0 +1,62 @@
+#include <memory>
+#include <utility>
+#include "Benchmark.h"
+
+/// <summary>
+/// Query throughput on 1000 devices with 10 axes each, against reading the same speeds with GetValue
+/// </summary>
+BENCHMARK(Query)
+{
+	const int devices = 1000;
+	const int axes = 10;
+	const int runs = 20;
+
+	std::unique_ptr<DataContainer> config(BuildMachineConfig(devices, axes));
+
+	std::vector<std::string> speedKeys;
+	for (int d = 0; d < devices; d++)
+	{
+		for (int a = 0; a < axes; a++)
+		{
+			speedKeys.push_back("Device" + std::to_string(d) + ".Axis" + std::to_string(a) + ".Speed");
+		}
+	}
+
+	double speed = 0;
+	double seconds = Seconds([&]()
+	{
+		for (int i = 0; i < runs; i++)
+		{
+			for (const std::string& key : speedKeys)
+			{
+				config->GetValue(key, speed);
+			}
+		}
+	}) / runs;
+
+	std::printf("  %-24s %10s  %12s  %14s\n", "", "matches", "queries/s", "matches/s");
+	std::printf("  %-24s %10zu  %12.1f  %14.0f\n", "GetValue of every Speed", speedKeys.size(), 1 / seconds, speedKeys.size() / seconds);
+
+	const std::pair<const char*, NativeType> patterns[] =
+	{
+		{ "*.Axis*.Speed", NativeType::Double },
+		{ "Device1?.**", NativeType::None },
+		{ "**.Speed", NativeType::Double },
+		{ "**", NativeType::None },
+	};
+
+	for (const auto& pattern : patterns)
+	{
+		size_t matches = config->Query(pattern.first, pattern.second).size();
+
+		seconds = Seconds([&]()
+		{
+			for (int i = 0; i < runs; i++)
+			{
+				config->Query(pattern.first, [](void*, const std::string&, const QueryValue&) {}, nullptr, pattern.second);
+			}
+		}) / runs;
+
+		std::printf("  %-24s %10zu  %12.1f  %14.0f\n", pattern.first, matches, 1 / seconds, matches / seconds);
+	}
+}
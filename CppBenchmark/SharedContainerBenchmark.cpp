@@ -0,0 +1,65 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "Benchmark.h"
+#include "..\DataContainer.CLR\SharedContainer.h"
+
+/// <summary>
+/// Publish latency and lock free read latency of a shared segment, idle and while it is published continuously
+/// </summary>
+BENCHMARK(SharedContainer)
+{
+	const int publishes = 100;
+	const size_t reads = 1000000;
+
+	std::unique_ptr<DataContainer> config(BuildMachineConfig(100, 10));
+
+	SharedContainerPublisher publisher;
+	SharedContainerReader reader;
+
+	if (!publisher.Create("DataContainerBenchmark", 16 * 1024 * 1024) || !publisher.Publish(*config) || !reader.Attach("DataContainerBenchmark"))
+	{
+		std::printf("  could not create shared segment\n");
+		return;
+	}
+
+	double publish = Seconds([&]()
+	{
+		for (int i = 0; i < publishes; i++)
+		{
+			publisher.Publish(*config);
+		}
+	}) / publishes;
+
+	double speed = 0;
+	std::string serial;
+	uint64_t generation = 0;
+
+	double privateRead = NanosecondsPerCall(reads, [&]() { config->GetValue("Device42.Axis7.Speed", speed); });
+	double sharedRead = NanosecondsPerCall(reads, [&]() { reader.GetValue("Device42.Axis7.Speed", speed); });
+	double sharedString = NanosecondsPerCall(reads, [&]() { reader.GetValue("Device42.Serial", serial); });
+	double poll = NanosecondsPerCall(reads, [&]() { generation += reader.Generation(); });
+
+	std::atomic<bool> stop(false);
+	std::thread writer([&]()
+	{
+		while (!stop)
+		{
+			publisher.Publish(*config);
+		}
+	});
+
+	uint64_t before = reader.Generation();
+	double contendedRead = NanosecondsPerCall(reads, [&]() { reader.GetValue("Device42.Axis7.Speed", speed); });
+	uint64_t during = reader.Generation() - before;
+
+	stop = true;
+	writer.join();
+
+	std::printf("  Publish                       %10.1f us\n", publish * 1e6);
+	std::printf("  DataContainer::GetValue       %10.1f ns\n", privateRead);
+	std::printf("  Reader GetValue double        %10.1f ns\n", sharedRead);
+	std::printf("  Reader GetValue string        %10.1f ns\n", sharedString);
+	std::printf("  Reader Generation             %10.1f ns\n", poll);
+	std::printf("  Reader GetValue while publish %10.1f ns  %llu generations\n", contendedRead, static_cast<unsigned long long>(during));
+}
@@ -0,0 +1,47 @@
+#include <memory>
+#include "Benchmark.h"
+
+/// <summary>
+/// Startup load of a multi-MB XML file without the cache, when the cache is written and when it is used
+/// </summary>
+BENCHMARK(XmlCache)
+{
+	const int runs = 5;
+	TempDirectory directory("XmlCache");
+
+	std::unique_ptr<DataContainer> config(BuildMachineConfig(2000, 10));
+	std::string xml = directory.File("Machine.xml");
+	std::string cache = xml + ".dcc";
+	config->SaveAsXml(xml);
+
+	// keep one time initialization of both paths out of the measurement
+	std::unique_ptr<DataContainer> small(BuildMachineConfig(1, 1));
+	std::string warmUp = directory.File("WarmUp.xml");
+	small->SaveAsXml(warmUp);
+	DataContainer::LoadFromXml(warmUp, false);
+	DataContainer::LoadFromXml(warmUp, true);
+	DataContainer::LoadFromXml(warmUp, true);
+
+	double xmlOnly = Seconds([&]()
+	{
+		for (int i = 0; i < runs; i++)
+		{
+			DataContainer dc = DataContainer::LoadFromXml(xml, false);
+		}
+	}) / runs;
+
+	double miss = Seconds([&]() { DataContainer dc = DataContainer::LoadFromXml(xml, true); });
+
+	double hit = Seconds([&]()
+	{
+		for (int i = 0; i < runs; i++)
+		{
+			DataContainer dc = DataContainer::LoadFromXml(xml, true);
+		}
+	}) / runs;
+
+	std::printf("  XML %.2f MB, cache %.2f MB\n", Megabytes(std::filesystem::file_size(xml)), Megabytes(std::filesystem::file_size(cache)));
+	std::printf("  without cache          %8.2f ms\n", xmlOnly * 1e3);
+	std::printf("  cache written          %8.2f ms\n", miss * 1e3);
+	std::printf("  cache used             %8.2f ms  %.1fx\n", hit * 1e3, xmlOnly / hit);
+}
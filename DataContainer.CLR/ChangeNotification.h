@@ -3,6 +3,7 @@
 #include <functional>
 #include <string>
 #include "ValueConverter.h"
+#include "ChangeWatchTable.h"
 
 class UnmanagedPropertyChangedListener
 {
@@ -12,33 +13,68 @@ public:
 		callBacks.push_back(fn);
 	}
 
+	WatchHandle Watch(const std::string& key, bool prefix, ChangeCallback callback, void* state)
+	{
+		return watches.Add(key, prefix, callback, state);
+	}
+
+	bool Unwatch(WatchHandle handle)
+	{
+		return watches.Remove(handle);
+	}
+
 	void Notify(std::string prop)
 	{
 		for (auto& action : callBacks)
 		{
 			action(prop);
 		}
+
+		watches.Notify(prop);
 	}
 
 private:
 	std::vector<std::function<void(std::string)>> callBacks;
+	ChangeWatchTable watches;
 };
 
+/// <summary>
+/// Forwards PropertyChanged of a container to the listener of the wrapper that owns it,
+/// the wrapper must call Detach before the listener is destroyed.
+/// </summary>
 ref class PropertyChangedListener
 {
 public:
 	PropertyChangedListener(System::ComponentModel::INotifyPropertyChanged^ inpc, UnmanagedPropertyChangedListener* um)
 	{
-		inpc->PropertyChanged += gcnew System::ComponentModel::PropertyChangedEventHandler(this, &PropertyChangedListener::OnPropertyChanged);
+		handler = gcnew System::ComponentModel::PropertyChangedEventHandler(this, &PropertyChangedListener::OnPropertyChanged);
+		source = inpc;
+		source->PropertyChanged += handler;
 		listner = um;
 	}
 
 	void OnPropertyChanged(System::Object^ sender, System::ComponentModel::PropertyChangedEventArgs^ e)
 	{
-		listner->Notify(ValueConverter<std::string>::GetUnmanaged(e->PropertyName));
+		if (listner)
+		{
+			listner->Notify(ValueConverter<std::string>::GetUnmanaged(e->PropertyName));
+		}
+	}
+
+	void Detach()
+	{
+		if (source != nullptr)
+		{
+			source->PropertyChanged -= handler;
+			source = nullptr;
+		}
+
+		listner = nullptr;
 	}
 
 private:
 
+	System::ComponentModel::INotifyPropertyChanged^ source;
+	System::ComponentModel::PropertyChangedEventHandler^ handler;
 	UnmanagedPropertyChangedListener* listner;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <cstdint>
+
+class DataContainer;
+
+/// <summary>
+/// Identifies a watch registered with DataContainer::Watch, 0 is never a valid handle
+/// </summary>
+typedef uint64_t WatchHandle;
+
+/// <summary>
+/// Called once with the full key of the value that changed
+/// </summary>
+typedef void (*ChangeCallback)(void* state, const std::string& key);
+
+/// <summary>
+/// Called once when an asynchronous load completes, result is nullptr if loading failed
+/// and is owned by the callee otherwise.
+/// </summary>
+typedef void (*LoadCallback)(void* state, DataContainer* result);
+
+/// <summary>
+/// Called once when an asynchronous save completes
+/// </summary>
+typedef void (*SaveCallback)(void* state, bool result);
+
+/// <summary>
+/// Runs work posted to it, used to choose where awaiting coroutines are resumed.
+/// </summary>
+class Executor
+{
+public:
+	virtual ~Executor() = default;
+
+	virtual void Post(void (*work)(void* state), void* state) = 0;
+};
+
+/// <summary>
+/// Returned by DataContainer::Changed and DataContainer::AnyChanged,
+/// can be awaited after including DataContainerAsync.h
+/// </summary>
+struct ChangeSubscription
+{
+	DataContainer* container;
+	std::string key;
+	bool prefix;
+	Executor* executor;
+};
+
+/// <summary>
+/// Returned by DataContainer::LoadFromXmlAsync, can be awaited after including DataContainerAsync.h
+/// </summary>
+struct LoadOperation
+{
+	std::string path;
+	Executor* executor;
+};
+
+/// <summary>
+/// Returned by DataContainer::SaveAsync, can be awaited after including DataContainerAsync.h
+/// </summary>
+struct SaveOperation
+{
+	DataContainer* container;
+	std::string path;
+	Executor* executor;
+};
@@ -0,0 +1,143 @@
+#include "ChangeWatchTable.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+struct ChangeWatchTable::State
+{
+	struct Watch
+	{
+		ChangeCallback callback;
+		void* state;
+		std::string key;
+		bool prefix;
+	};
+
+	std::mutex mutex;
+	WatchHandle next = 1;
+	std::unordered_map<WatchHandle, Watch> watches;
+	std::unordered_map<std::string, std::vector<WatchHandle>> keys;
+	std::unordered_map<std::string, std::vector<WatchHandle>> prefixes;
+
+	/// <summary>
+	/// Moves watches registered under key in to fired
+	/// </summary>
+	void Take(std::unordered_map<std::string, std::vector<WatchHandle>>& index, const std::string& key, std::vector<Watch>& fired)
+	{
+		auto it = index.find(key);
+
+		if (it == index.end())
+		{
+			return;
+		}
+
+		for (WatchHandle handle : it->second)
+		{
+			auto watch = watches.find(handle);
+
+			if (watch != watches.end())
+			{
+				fired.push_back(watch->second);
+				watches.erase(watch);
+			}
+		}
+
+		index.erase(it);
+	}
+};
+
+ChangeWatchTable::ChangeWatchTable()
+{
+	state = new State();
+}
+
+ChangeWatchTable::ChangeWatchTable(const ChangeWatchTable&)
+{
+	state = new State();
+}
+
+ChangeWatchTable& ChangeWatchTable::operator=(const ChangeWatchTable&)
+{
+	return *this;
+}
+
+ChangeWatchTable::~ChangeWatchTable()
+{
+	delete state;
+}
+
+WatchHandle ChangeWatchTable::Add(const std::string& key, bool prefix, ChangeCallback callback, void* callbackState)
+{
+	std::lock_guard<std::mutex> lock(state->mutex);
+
+	WatchHandle handle = state->next++;
+	state->watches.emplace(handle, State::Watch{ callback, callbackState, key, prefix });
+	(prefix ? state->prefixes : state->keys)[key].push_back(handle);
+
+	return handle;
+}
+
+bool ChangeWatchTable::Remove(WatchHandle handle)
+{
+	std::lock_guard<std::mutex> lock(state->mutex);
+
+	auto watch = state->watches.find(handle);
+
+	if (watch == state->watches.end())
+	{
+		return false;
+	}
+
+	auto& index = watch->second.prefix ? state->prefixes : state->keys;
+	auto handles = index.find(watch->second.key);
+
+	if (handles != index.end())
+	{
+		handles->second.erase(std::remove(handles->second.begin(), handles->second.end(), handle), handles->second.end());
+
+		if (handles->second.empty())
+		{
+			index.erase(handles);
+		}
+	}
+
+	state->watches.erase(watch);
+
+	return true;
+}
+
+void ChangeWatchTable::Notify(const std::string& key)
+{
+	std::vector<State::Watch> fired;
+
+	{
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		if (state->watches.empty())
+		{
+			return;
+		}
+
+		state->Take(state->keys, key, fired);
+
+		if (state->prefixes.empty() == false)
+		{
+			// every prefix of A.B.C is a candidate, "", "A", "A.B" and "A.B.C"
+			state->Take(state->prefixes, std::string(), fired);
+
+			for (size_t dot = key.find('.'); dot != std::string::npos; dot = key.find('.', dot + 1))
+			{
+				state->Take(state->prefixes, key.substr(0, dot), fired);
+			}
+
+			state->Take(state->prefixes, key, fired);
+		}
+	}
+
+	// callbacks may resume coroutines which register new watches, so call them without holding the lock
+	for (auto& watch : fired)
+	{
+		watch.callback(watch.state, key);
+	}
+}
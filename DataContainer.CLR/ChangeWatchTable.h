@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include "ChangeWatch.h"
+
+/// <summary>
+/// One shot watches on keys or key prefixes of a container.
+/// Implemented in a native translation unit so it can be guarded with std::mutex,
+/// watches are registered from awaiting threads and fired from whichever thread changed the value.
+/// Watches belong to the instance that registered them and are not copied.
+/// </summary>
+class ChangeWatchTable
+{
+public:
+	ChangeWatchTable();
+	ChangeWatchTable(const ChangeWatchTable&);
+	ChangeWatchTable& operator=(const ChangeWatchTable&);
+	~ChangeWatchTable();
+
+	/// <summary>
+	/// Registers callback to be called once when key changes,
+	/// if prefix is true any key equal to or nested under key will fire it, empty prefix matches every key.
+	/// </summary>
+	WatchHandle Add(const std::string& key, bool prefix, ChangeCallback callback, void* state);
+
+	/// <summary>
+	/// Removes a watch that has not fired yet, returns false if it already fired
+	/// </summary>
+	bool Remove(WatchHandle handle);
+
+	/// <summary>
+	/// Fires and removes all watches matching key
+	/// </summary>
+	void Notify(const std::string& key);
+
+private:
+	struct State;
+	State* state;
+};
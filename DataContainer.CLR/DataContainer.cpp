@@ -1,5 +1,6 @@
 #include "pch.h"
 #include <iostream>
+#include <algorithm>
 #include <msclr\marshal_cppstd.h>
 #include "DataContainer.h"
 #include "DataContainerWrapper.h"
@@ -93,11 +94,120 @@ bool DataContainer::SetValue(std::string key, DataContainer* value)
 	return managed->SetValue(key, *value->managed);
 }
 
+bool DataContainer::GetValue(std::string key, Blob& value)
+{
+	return managed->GetValue(key, *value.managed);
+}
+
+void DataContainer::PutValue(std::string key, const Blob& value)
+{
+	managed->PutValue(key, *value.managed);
+}
+
+bool DataContainer::SetValue(std::string key, const Blob& value)
+{
+	return managed->SetValue(key, *value.managed);
+}
+
 void DataContainer::AttachPropertyChangedListner(std::function<void(std::string)> listener)
 {
 	managed->AttachListener(listener);
 }
 
+static void CollectMatch(void* state, const std::string& key, const QueryValue& value)
+{
+	static_cast<std::vector<QueryMatch>*>(state)->push_back(QueryMatch{ key, value });
+}
+
+std::vector<QueryMatch> DataContainer::Query(std::string pattern, NativeType type)
+{
+	std::vector<QueryMatch> matches;
+	managed->Query(pattern, type, &CollectMatch, &matches);
+	return matches;
+}
+
+void DataContainer::Query(std::string pattern, QueryVisitor visitor, void* state, NativeType type)
+{
+	managed->Query(pattern, type, visitor, state);
+}
+
+BindingHandle DataContainer::Bind(std::string key, BindingTarget target)
+{
+	return managed->Bind(key, target);
+}
+
+std::vector<BindingHandle> DataContainer::Bind(std::string prefix, std::initializer_list<FieldBinding> fields)
+{
+	std::vector<BindingHandle> handles;
+	handles.reserve(fields.size());
+
+	for (auto& field : fields)
+	{
+		handles.push_back(managed->Bind(prefix.empty() ? field.key : prefix + "." + field.key, field.target));
+	}
+
+	return handles;
+}
+
+bool DataContainer::Unbind(BindingHandle handle)
+{
+	return managed->Unbind(handle);
+}
+
+std::vector<BindingHandle> DataContainer::Bind(std::string prefix, const SchemaDescriptor& schema, void* target)
+{
+	std::vector<BindingHandle> handles;
+	handles.reserve(schema.count);
+
+	for (size_t i = 0; i < schema.count; i++)
+	{
+		const SchemaField& field = schema.fields[i];
+		BindingTarget fieldTarget{ static_cast<char*>(target) + field.offset, field.type, field.write };
+
+		handles.push_back(managed->Bind(prefix.empty() ? field.key : prefix + "." + field.key, fieldTarget));
+	}
+
+	return handles;
+}
+
+bool DataContainer::Morph(const SchemaDescriptor& schema, void* target)
+{
+	return managed->Morph(schema, target);
+}
+
+std::vector<SchemaMismatch> DataContainer::CheckSchema(const SchemaDescriptor& schema)
+{
+	return managed->CheckSchema(schema);
+}
+
+DataContainer DataContainer::FromObject(const SchemaDescriptor& schema, const void* source)
+{
+	DataContainerWrapper* wrapper = new DataContainerWrapper();
+	wrapper->FromObject(schema, source);
+
+	return DataContainer(wrapper);
+}
+
+WatchHandle DataContainer::Watch(std::string key, bool prefix, ChangeCallback callback, void* state)
+{
+	return managed->Watch(key, prefix, callback, state);
+}
+
+bool DataContainer::Unwatch(WatchHandle handle)
+{
+	return managed->Unwatch(handle);
+}
+
+void DataContainer::BeginLoadFromXml(std::string path, LoadCallback completed, void* state)
+{
+	DataContainerWrapper::BeginLoadFromXml(path, completed, state);
+}
+
+void DataContainer::BeginSaveAsXml(std::string path, SaveCallback completed, void* state)
+{
+	managed->BeginSaveAsXml(path, completed, state);
+}
+
 std::vector<std::string> DataContainer::GetKeys()
 {
 	return managed->GetKeys();
@@ -108,11 +218,41 @@ DataContainer DataContainer::LoadFromXml(std::string path)
 	return DataContainer(DataContainerWrapper::LoadFromXml(path));
 }
 
+DataContainer DataContainer::LoadFromXml(std::string path, bool useCache)
+{
+	return DataContainer(DataContainerWrapper::LoadFromXml(path, useCache));
+}
+
+DataContainer DataContainer::LoadFromXml(std::string path, const SchemaDescriptor& schema, std::vector<SchemaMismatch>& mismatches)
+{
+	return DataContainer(DataContainerWrapper::LoadFromXml(path, schema, mismatches));
+}
+
 DataContainer DataContainer::LoadFromBinary(std::string path)
 {
 	return DataContainer(DataContainerWrapper::LoadFromBinary(path));
 }
 
+DataContainer DataContainer::LoadFromCompressedBinary(std::string path, const std::vector<std::string>& keys)
+{
+	return DataContainer(DataContainerWrapper::LoadFromCompressedBinary(path, keys));
+}
+
+DataContainer DataContainer::LoadFromJson(std::string path)
+{
+	return DataContainer(DataContainerWrapper::LoadFromJson(path));
+}
+
+DataContainer DataContainer::LoadDirectory(std::string path, std::string pattern, std::vector<LoadError>& errors)
+{
+	return DataContainer(DataContainerWrapper::LoadDirectory(path, pattern, errors));
+}
+
+int64_t DataContainer::AllocatedBytes()
+{
+	return GC::GetAllocatedBytesForCurrentThread();
+}
+
 bool DataContainer::SaveAsXml(std::string path)
 {
 	return managed->SaveAsXml(path);
@@ -133,12 +273,166 @@ bool DataContainer::SaveAsBinary()
 	return managed->SaveAsBinary();
 }
 
+bool DataContainer::SaveAsCompressedBinary(std::string path)
+{
+	return managed->SaveAsCompressedBinary(path);
+}
+
+bool DataContainer::SaveAsJson(std::string path)
+{
+	return managed->SaveAsJson(path);
+}
+
 
 #pragma endregion
 
 
+#pragma region Blob
+
+/// <summary>
+/// Size of the managed buffer blobs are copied through
+/// </summary>
+static const size_t BlobChunkSize = 64 * 1024;
+
+Blob::Blob()
+{
+	managed = new BlobWrapper(gcnew System::Configuration::Blob());
+}
+
+Blob::Blob(const void* data, size_t size)
+{
+	array<Byte>^ bytes = gcnew array<Byte>(static_cast<int>(size));
+
+	if (size > 0)
+	{
+		System::Runtime::InteropServices::Marshal::Copy(IntPtr(const_cast<void*>(data)), bytes, 0, bytes->Length);
+	}
+
+	managed = new BlobWrapper(gcnew System::Configuration::Blob(bytes));
+}
+
+Blob::Blob(const Blob& other)
+{
+	managed = new BlobWrapper(*other.managed);
+}
+
+Blob& Blob::operator=(const Blob& other)
+{
+	if (this != &other)
+	{
+		managed->instance = other.managed->instance;
+	}
+
+	return *this;
+}
+
+Blob::~Blob()
+{
+	delete managed;
+}
+
+uint64_t Blob::Length() const
+{
+	return static_cast<uint64_t>(managed->instance->Length);
+}
+
+size_t Blob::Read(uint64_t offset, void* buffer, size_t size) const
+{
+	System::Configuration::Blob^ blob = managed->instance;
+	array<Byte>^ chunk = gcnew array<Byte>(static_cast<int>(std::min(size, BlobChunkSize)));
+	size_t total = 0;
+
+	try
+	{
+		while (total < size)
+		{
+			int count = blob->Read(static_cast<long long>(offset + total), chunk, 0, static_cast<int>(std::min(size - total, BlobChunkSize)));
+
+			if (count <= 0)
+			{
+				break;
+			}
+
+			System::Runtime::InteropServices::Marshal::Copy(chunk, 0, IntPtr(static_cast<char*>(buffer) + total), count);
+			total += count;
+		}
+	}
+	catch (Exception^)
+	{
+	}
+
+	return total;
+}
+
+bool Blob::Write(uint64_t offset, const void* data, size_t size)
+{
+	System::Configuration::Blob^ blob = managed->instance;
+	array<Byte>^ chunk = gcnew array<Byte>(static_cast<int>(std::min(size, BlobChunkSize)));
+	size_t total = 0;
+
+	try
+	{
+		while (total < size)
+		{
+			int count = static_cast<int>(std::min(size - total, BlobChunkSize));
+
+			System::Runtime::InteropServices::Marshal::Copy(IntPtr(const_cast<char*>(static_cast<const char*>(data)) + total), chunk, 0, count);
+			blob->Write(static_cast<long long>(offset + total), chunk, 0, count);
+			total += count;
+		}
+	}
+	catch (Exception^)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+#pragma endregion
+
 #pragma region Wrapper
 
+/// <summary>
+/// Continuation of DataContainer.FromXmlFileAsync, hands the result to native code
+/// </summary>
+ref class LoadCompletion
+{
+public:
+	LoadCompletion(LoadCallback completed, void* state) : completed(completed), state(state) {}
+
+	void OnCompleted(System::Threading::Tasks::Task<System::Configuration::IDataContainer^>^ task)
+	{
+		System::Configuration::IDataContainer^ dc = task->Status == System::Threading::Tasks::TaskStatus::RanToCompletion
+			? task->Result
+			: nullptr;
+
+		completed(state, dc == nullptr ? nullptr : new DataContainer(new DataContainerWrapper(dc)));
+	}
+
+private:
+	LoadCallback completed;
+	void* state;
+};
+
+/// <summary>
+/// Continuation of DataContainerBase.SaveAsXmlAsync, hands the result to native code
+/// </summary>
+ref class SaveCompletion
+{
+public:
+	SaveCompletion(SaveCallback completed, void* state) : completed(completed), state(state) {}
+
+	void OnCompleted(System::Threading::Tasks::Task<bool>^ task)
+	{
+		completed(state, task->Status == System::Threading::Tasks::TaskStatus::RanToCompletion && task->Result);
+	}
+
+private:
+	SaveCallback completed;
+	void* state;
+};
+
 DataContainerWrapper::DataContainerWrapper()
 {
 	instance = gcnew System::Configuration::DataContainer();
@@ -157,6 +451,36 @@ DataContainerWrapper::DataContainerWrapper(System::Configuration::IDataContainer
 	instance = managed;
 }
 
+DataContainerWrapper::DataContainerWrapper(const DataContainerWrapper& other)
+	: DataContainerWrapper(other.GetInstance())
+{
+	unmanagedListner = other.unmanagedListner;
+}
+
+DataContainerWrapper& DataContainerWrapper::operator=(const DataContainerWrapper& other)
+{
+	if (this != &other)
+	{
+		// the listener points to this wrapper, so it is replaced instead of copied
+		listner->Detach();
+
+		instance = other.GetInstance();
+		unmanagedListner = other.unmanagedListner;
+		paths = other.paths;
+
+		System::ComponentModel::INotifyPropertyChanged^ inpc = safe_cast<System::ComponentModel::INotifyPropertyChanged^>(GetInstance());
+
+		listner = gcnew PropertyChangedListener(inpc, &unmanagedListner);
+	}
+
+	return *this;
+}
+
+DataContainerWrapper::~DataContainerWrapper()
+{
+	listner->Detach();
+}
+
 std::vector<std::string> DataContainerWrapper::GetKeys()
 {
 	std::vector<std::string> keys;
@@ -175,6 +499,58 @@ DataContainerWrapper* DataContainerWrapper::LoadFromXml(std::string path)
 	return new DataContainerWrapper(dc);
 }
 
+DataContainerWrapper* DataContainerWrapper::LoadFromXml(std::string path, bool useCache)
+{
+	System::Configuration::IDataContainer^ dc = System::Configuration::DataContainer::FromXmlFile(gcnew String(path.c_str()), useCache);
+	return new DataContainerWrapper(dc);
+}
+
+DataContainerWrapper* DataContainerWrapper::LoadFromXml(std::string path, const SchemaDescriptor& schema, std::vector<SchemaMismatch>& mismatches)
+{
+	DataContainerWrapper* wrapper = LoadFromXml(path);
+
+	if (wrapper->GetInstance() != nullptr)
+	{
+		mismatches = wrapper->CheckSchema(schema);
+	}
+
+	return wrapper;
+}
+
+DataContainerWrapper* DataContainerWrapper::LoadFromCompressedBinary(std::string path, const std::vector<std::string>& keys)
+{
+	array<String^>^ managedKeys = gcnew array<String^>(static_cast<int>(keys.size()));
+
+	for (int i = 0; i < managedKeys->Length; i++)
+	{
+		managedKeys[i] = gcnew String(keys[i].c_str());
+	}
+
+	System::Configuration::IDataContainer^ dc = System::Configuration::DataContainer::FromCompressedBinaryFile(gcnew String(path.c_str()), managedKeys);
+	return new DataContainerWrapper(dc);
+}
+
+DataContainerWrapper* DataContainerWrapper::LoadFromJson(std::string path)
+{
+	System::Configuration::IDataContainer^ dc = System::Configuration::DataContainer::FromJsonFile(gcnew String(path.c_str()));
+	return new DataContainerWrapper(dc);
+}
+
+DataContainerWrapper* DataContainerWrapper::LoadDirectory(std::string path, std::string pattern, std::vector<LoadError>& errors)
+{
+	System::Collections::Generic::IDictionary<String^, String^>^ failed;
+	System::Configuration::IDataContainer^ dc = System::Configuration::DataContainer::FromDirectory(gcnew String(path.c_str()), gcnew String(pattern.c_str()), failed);
+
+	errors.clear();
+
+	for each (System::Collections::Generic::KeyValuePair<String^, String^> entry in failed)
+	{
+		errors.push_back(LoadError{ ValueConverter<std::string>::GetUnmanaged(entry.Key), ValueConverter<std::string>::GetUnmanaged(entry.Value) });
+	}
+
+	return new DataContainerWrapper(dc);
+}
+
 DataContainerWrapper* DataContainerWrapper::LoadFromBinary(std::string path)
 {
 	System::Configuration::IDataContainer^ dc = System::Configuration::DataContainer::FromBinaryFile(gcnew String(path.c_str()));
@@ -187,6 +563,23 @@ DataContainerWrapper* DataContainerWrapper::LoadFromBinary(std::string path)
 	return new DataContainerWrapper(dc);
 }
 
+void DataContainerWrapper::BeginLoadFromXml(std::string path, LoadCallback completed, void* state)
+{
+	LoadCompletion^ completion = gcnew LoadCompletion(completed, state);
+
+	System::Configuration::DataContainer::FromXmlFileAsync(gcnew String(path.c_str()))->ContinueWith(
+		gcnew Action<System::Threading::Tasks::Task<System::Configuration::IDataContainer^>^>(completion, &LoadCompletion::OnCompleted));
+}
+
+void DataContainerWrapper::BeginSaveAsXml(std::string path, SaveCallback completed, void* state)
+{
+	SaveCompletion^ completion = gcnew SaveCompletion(completed, state);
+	System::Configuration::DataContainerBase^ dc = safe_cast<System::Configuration::DataContainerBase^>(GetInstance());
+
+	dc->SaveAsXmlAsync(gcnew String(path.c_str()))->ContinueWith(
+		gcnew Action<System::Threading::Tasks::Task<bool>^>(completion, &SaveCompletion::OnCompleted));
+}
+
 bool DataContainerWrapper::SaveAsXml(std::string path)
 {
 	return instance->SaveAsXml(gcnew String(path.c_str()));
@@ -207,6 +600,16 @@ bool DataContainerWrapper::SaveAsBinary()
 	return instance->SaveAsBinary();
 }
 
+bool DataContainerWrapper::SaveAsCompressedBinary(std::string path)
+{
+	return System::Configuration::CompressedBinaryHelper::SerializeToFile(instance, gcnew String(path.c_str()));
+}
+
+bool DataContainerWrapper::SaveAsJson(std::string path)
+{
+	return System::Configuration::JsonHelper::SerializeToFile(instance, gcnew String(path.c_str()));
+}
+
 #pragma endregion
 
 #pragma warning(pop)
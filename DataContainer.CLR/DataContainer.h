@@ -3,11 +3,20 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <initializer_list>
+#include "NativeBinding.h"
+#include "NativeSchema.h"
+#include "ChangeWatch.h"
+#include "NativeQuery.h"
 
 class DataContainerWrapper;
+class BlobWrapper;
+class Blob;
 struct Duration;
 struct Point;
 struct Color;
+struct LoadError;
+struct QueryMatch;
 
 class DATACONTAINER_API DataContainer
 {
@@ -19,7 +28,36 @@ public:
 	std::vector<std::string> GetKeys();
 
 	static DataContainer LoadFromXml(std::string path);
+
+	/// <summary>
+	/// With useCache a pre-parsed image is kept next to the file and used instead of parsing XML
+	/// as long as the file is unchanged.
+	/// </summary>
+	static DataContainer LoadFromXml(std::string path, bool useCache);
+	static DataContainer LoadFromXml(std::string path, const SchemaDescriptor& schema, std::vector<SchemaMismatch>& mismatches);
 	static DataContainer LoadFromBinary(std::string path);
+
+	/// <summary>
+	/// Loads compressed binary file, only blocks holding the given top level keys are decompressed.
+	/// Everything is loaded if keys is empty.
+	/// </summary>
+	static DataContainer LoadFromCompressedBinary(std::string path, const std::vector<std::string>& keys = {});
+
+	/// <summary>
+	/// Loads JSON file written by SaveAsJson, or any JSON object
+	/// </summary>
+	static DataContainer LoadFromJson(std::string path);
+
+	/// <summary>
+	/// Loads every XML file in path matching pattern in parallel, each in to a child container keyed by file name.
+	/// Files that could not be loaded are reported in errors.
+	/// </summary>
+	static DataContainer LoadDirectory(std::string path, std::string pattern, std::vector<LoadError>& errors);
+
+	/// <summary>
+	/// Managed bytes allocated so far by the calling thread, the difference of two calls is what was allocated in between.
+	/// </summary>
+	static int64_t AllocatedBytes();
 	
 	bool SaveAsXml(std::string path);
 	bool SaveAsXml();
@@ -27,6 +65,10 @@ public:
 	bool SaveAsBinary(std::string path);
 	bool SaveAsBinary();
 
+	bool SaveAsCompressedBinary(std::string path);
+
+	bool SaveAsJson(std::string path);
+
 	bool GetValue(std::string key, std::string& value);
 	bool GetValue(std::string key, bool& value);
 	bool GetValue(std::string key, uint16_t& value);
@@ -42,6 +84,7 @@ public:
 	bool GetValue(std::string key, Duration& value);
 	bool GetValue(std::string key, Point& value);
 	bool GetValue(std::string key, Color& value);
+	bool GetValue(std::string key, Blob& value);
 
 	void PutValue(std::string key, uint16_t value);
 	void PutValue(std::string key, uint32_t value);
@@ -59,6 +102,7 @@ public:
 	void PutValue(std::string key, Duration value);
 	void PutValue(std::string key, Point value);
 	void PutValue(std::string key, Color value);
+	void PutValue(std::string key, const Blob& value);
 
 	bool SetValue(std::string key, uint16_t value);
 	bool SetValue(std::string key, uint32_t value);
@@ -76,9 +120,98 @@ public:
 	bool SetValue(std::string key, Duration value);
 	bool SetValue(std::string key, Point value);
 	bool SetValue(std::string key, Color value);
+	bool SetValue(std::string key, const Blob& value);
 
 	void AttachPropertyChangedListner(std::function<void(std::string)> listener);
 
+	WatchHandle Watch(std::string key, bool prefix, ChangeCallback callback, void* state);
+	bool Unwatch(WatchHandle handle);
+
+	ChangeSubscription Changed(std::string key, Executor* executor = nullptr)
+	{
+		return ChangeSubscription{ this, key, false, executor };
+	}
+
+	ChangeSubscription AnyChanged(std::string prefix = "", Executor* executor = nullptr)
+	{
+		return ChangeSubscription{ this, prefix, true, executor };
+	}
+
+	static void BeginLoadFromXml(std::string path, LoadCallback completed, void* state);
+	void BeginSaveAsXml(std::string path, SaveCallback completed, void* state);
+
+	static LoadOperation LoadFromXmlAsync(std::string path, Executor* executor = nullptr)
+	{
+		return LoadOperation{ path, executor };
+	}
+
+	SaveOperation SaveAsync(std::string path, Executor* executor = nullptr)
+	{
+		return SaveOperation{ this, path, executor };
+	}
+
+	/// <summary>
+	/// Finds all values whose key matches pattern in one walk of the tree, like "*.Axis*.Speed" or "Theme.**".
+	/// '*' and '?' match within a segment, "**" matches any number of segments.
+	/// Only values of a DataContainer.h type are returned, restricted to type unless it is NativeType::None.
+	/// </summary>
+	std::vector<QueryMatch> Query(std::string pattern, NativeType type = NativeType::None);
+	void Query(std::string pattern, QueryVisitor visitor, void* state, NativeType type = NativeType::None);
+
+	BindingHandle Bind(std::string key, BindingTarget target);
+	std::vector<BindingHandle> Bind(std::string prefix, std::initializer_list<FieldBinding> fields);
+	bool Unbind(BindingHandle handle);
+
+	template <typename T>
+	BindingHandle Bind(std::string key, T* target)
+	{
+		return Bind(key, MakeBindingTarget(target));
+	}
+
+	std::vector<BindingHandle> Bind(std::string prefix, const SchemaDescriptor& schema, void* target);
+
+	bool Morph(const SchemaDescriptor& schema, void* target);
+	std::vector<SchemaMismatch> CheckSchema(const SchemaDescriptor& schema);
+	static DataContainer FromObject(const SchemaDescriptor& schema, const void* source);
+
+	template <typename T>
+	std::vector<BindingHandle> BindObject(std::string prefix, T* target)
+	{
+		return Bind(prefix, Schema<T>::Descriptor(), target);
+	}
+
+	template <typename T>
+	bool Morph(T& target)
+	{
+		return Morph(Schema<T>::Descriptor(), &target);
+	}
+
+	template <typename T>
+	T Morph()
+	{
+		T result{};
+		Morph(Schema<T>::Descriptor(), &result);
+		return result;
+	}
+
+	template <typename T>
+	std::vector<SchemaMismatch> CheckSchema()
+	{
+		return CheckSchema(Schema<T>::Descriptor());
+	}
+
+	template <typename T>
+	static DataContainer FromObject(const T& source)
+	{
+		return FromObject(Schema<T>::Descriptor(), &source);
+	}
+
+	template <typename T>
+	static DataContainer LoadFromXml(std::string path, std::vector<SchemaMismatch>& mismatches)
+	{
+		return LoadFromXml(path, Schema<T>::Descriptor(), mismatches);
+	}
+
 private:
 	DataContainerWrapper* managed;
 };
@@ -108,3 +241,119 @@ public:
 	unsigned char g;
 	unsigned char b;
 };
+
+/// <summary>
+/// Handle to a blob value, a large binary payload that is read and written in chunks instead of being copied as a whole.
+/// Copies of a handle refer to the same blob, blobs loaded from compressed binary files are read from the file on demand.
+/// </summary>
+class DATACONTAINER_API Blob
+{
+public:
+	Blob();
+	Blob(const void* data, size_t size);
+	Blob(const Blob& other);
+	Blob& operator=(const Blob& other);
+	~Blob();
+
+	uint64_t Length() const;
+
+	/// <summary>
+	/// Copies up to size bytes starting at offset in to buffer, returns the number of bytes copied
+	/// </summary>
+	size_t Read(uint64_t offset, void* buffer, size_t size) const;
+
+	/// <summary>
+	/// Writes size bytes of data at offset, the blob grows if needed
+	/// </summary>
+	bool Write(uint64_t offset, const void* data, size_t size);
+
+private:
+	friend class DataContainer;
+	BlobWrapper* managed;
+};
+
+struct LoadError
+{
+public:
+	std::string path;
+	std::string message;
+};
+
+/// <summary>
+/// Value found by DataContainer::Query, only the member selected by type is valid
+/// </summary>
+struct QueryValue
+{
+public:
+	NativeType type = NativeType::None;
+
+	union
+	{
+		bool boolValue;
+		uint16_t uint16Value;
+		uint32_t uint32Value;
+		uint64_t uint64Value;
+		int16_t int16Value;
+		int32_t int32Value;
+		int64_t int64Value;
+		float floatValue;
+		double doubleValue;
+		tm dateTimeValue;
+		Duration timeSpanValue;
+		Point pointValue;
+		Color colorValue;
+	};
+
+	std::string stringValue;
+
+	QueryValue() : uint64Value(0) {}
+
+	/// <summary>
+	/// Copies the value in to value if it holds a T, returns false otherwise
+	/// </summary>
+	template <typename T>
+	bool Get(T& value) const
+	{
+		if (type == NativeType::None || NativeTypeOf<T>::value != type)
+		{
+			return false;
+		}
+
+		value = *static_cast<const T*>(Address());
+		return true;
+	}
+
+	const void* Address() const
+	{
+		switch (type)
+		{
+		case NativeType::String: return &stringValue;
+		case NativeType::Bool: return &boolValue;
+		case NativeType::UInt16: return &uint16Value;
+		case NativeType::UInt32: return &uint32Value;
+		case NativeType::UInt64: return &uint64Value;
+		case NativeType::Int16: return &int16Value;
+		case NativeType::Int32: return &int32Value;
+		case NativeType::Int64: return &int64Value;
+		case NativeType::Float: return &floatValue;
+		case NativeType::Double: return &doubleValue;
+		case NativeType::DateTime: return &dateTimeValue;
+		case NativeType::TimeSpan: return &timeSpanValue;
+		case NativeType::Point: return &pointValue;
+		case NativeType::Color: return &colorValue;
+		default: return nullptr;
+		}
+	}
+
+	void* Address()
+	{
+		return const_cast<void*>(static_cast<const QueryValue*>(this)->Address());
+	}
+};
+
+struct QueryMatch
+{
+public:
+	std::string key;
+	QueryValue value;
+};
@@ -0,0 +1,251 @@
+#pragma once
+// Coroutine support for DataContainer, requires C++20.
+// Only include from native code, C++/CLI does not support coroutines.
+#include <coroutine>
+#include <memory>
+#include <atomic>
+#include <string>
+#include "DataContainer.h"
+
+/// <summary>
+/// Resumes coroutine on executor, or on the current thread if there is none
+/// </summary>
+inline void ResumeOn(Executor* executor, std::coroutine_handle<> coroutine)
+{
+	if (executor)
+	{
+		executor->Post([](void* address) { std::coroutine_handle<>::from_address(address).resume(); }, coroutine.address());
+	}
+	else
+	{
+		coroutine.resume();
+	}
+}
+
+/// <summary>
+/// Awaiter for DataContainer::Changed and DataContainer::AnyChanged, resumes with the key that changed.
+/// Shares its state with the registered watch, whichever of firing and destroying the awaiter comes first wins,
+/// so a coroutine destroyed while waiting is never resumed and its watch is removed.
+/// </summary>
+class ChangeAwaiter
+{
+public:
+	explicit ChangeAwaiter(ChangeSubscription subscription)
+		: subscription(std::move(subscription)), waiter(std::make_shared<Waiter>())
+	{
+		waiter->executor = this->subscription.executor;
+	}
+
+	ChangeAwaiter(const ChangeAwaiter&) = delete;
+	ChangeAwaiter& operator=(const ChangeAwaiter&) = delete;
+
+	~ChangeAwaiter()
+	{
+		if (waiter->done.exchange(true) || waiter->registration == nullptr)
+		{
+			return;
+		}
+
+		// a watch that was already taken for firing will see done and clean up after itself
+		if (subscription.container->Unwatch(waiter->handle))
+		{
+			delete waiter->registration;
+		}
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> coroutine)
+	{
+		std::shared_ptr<Waiter> state = waiter;
+
+		state->coroutine = coroutine;
+		state->registration = new std::shared_ptr<Waiter>(state);
+
+		// the watch may fire on another thread before Watch returns, nothing after this line may touch this
+		state->handle = subscription.container->Watch(subscription.key, subscription.prefix, &ChangeAwaiter::OnChanged, state->registration);
+	}
+
+	std::string await_resume()
+	{
+		return waiter->key;
+	}
+
+private:
+	struct Waiter
+	{
+		std::coroutine_handle<> coroutine;
+		Executor* executor = nullptr;
+		std::string key;
+		std::atomic<WatchHandle> handle{ 0 };
+		std::shared_ptr<Waiter>* registration = nullptr;
+		std::atomic<bool> done{ false };
+	};
+
+	static void OnChanged(void* state, const std::string& key)
+	{
+		std::unique_ptr<std::shared_ptr<Waiter>> owner(static_cast<std::shared_ptr<Waiter>*>(state));
+		Waiter& waiter = **owner;
+
+		if (waiter.done.exchange(true))
+		{
+			return;
+		}
+
+		waiter.key = key;
+		ResumeOn(waiter.executor, waiter.coroutine);
+	}
+
+	ChangeSubscription subscription;
+	std::shared_ptr<Waiter> waiter;
+};
+
+/// <summary>
+/// Awaiter for DataContainer::LoadFromXmlAsync, file is read without blocking a thread,
+/// resumes with the loaded container or nullptr if loading failed.
+/// The pending load owns a share of the completion state, a coroutine destroyed while loading is never resumed.
+/// </summary>
+class LoadAwaiter
+{
+public:
+	explicit LoadAwaiter(LoadOperation operation)
+		: operation(std::move(operation)), completion(std::make_shared<Completion>())
+	{
+		completion->executor = this->operation.executor;
+	}
+
+	LoadAwaiter(const LoadAwaiter&) = delete;
+	LoadAwaiter& operator=(const LoadAwaiter&) = delete;
+
+	~LoadAwaiter()
+	{
+		// a pending load sees this and deletes the loaded container instead of resuming
+		completion->done = true;
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> coroutine)
+	{
+		completion->coroutine = coroutine;
+		DataContainer::BeginLoadFromXml(operation.path, &LoadAwaiter::OnLoaded, new std::shared_ptr<Completion>(completion));
+	}
+
+	std::unique_ptr<DataContainer> await_resume()
+	{
+		return std::move(completion->result);
+	}
+
+private:
+	struct Completion
+	{
+		std::coroutine_handle<> coroutine;
+		Executor* executor = nullptr;
+		std::unique_ptr<DataContainer> result;
+		std::atomic<bool> done{ false };
+	};
+
+	static void OnLoaded(void* state, DataContainer* loaded)
+	{
+		std::unique_ptr<std::shared_ptr<Completion>> owner(static_cast<std::shared_ptr<Completion>*>(state));
+		std::unique_ptr<DataContainer> result(loaded);
+		Completion& completion = **owner;
+
+		if (completion.done.exchange(true))
+		{
+			return;
+		}
+
+		completion.result = std::move(result);
+		ResumeOn(completion.executor, completion.coroutine);
+	}
+
+	LoadOperation operation;
+	std::shared_ptr<Completion> completion;
+};
+
+/// <summary>
+/// Awaiter for DataContainer::SaveAsync, file is written without blocking a thread.
+/// The pending save owns a share of the completion state, a coroutine destroyed while saving is never resumed.
+/// </summary>
+class SaveAwaiter
+{
+public:
+	explicit SaveAwaiter(SaveOperation operation)
+		: operation(std::move(operation)), completion(std::make_shared<Completion>())
+	{
+		completion->executor = this->operation.executor;
+	}
+
+	SaveAwaiter(const SaveAwaiter&) = delete;
+	SaveAwaiter& operator=(const SaveAwaiter&) = delete;
+
+	~SaveAwaiter()
+	{
+		// a pending save sees this and completes without resuming
+		completion->done = true;
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> coroutine)
+	{
+		completion->coroutine = coroutine;
+		operation.container->BeginSaveAsXml(operation.path, &SaveAwaiter::OnSaved, new std::shared_ptr<Completion>(completion));
+	}
+
+	bool await_resume() const noexcept
+	{
+		return completion->result;
+	}
+
+private:
+	struct Completion
+	{
+		std::coroutine_handle<> coroutine;
+		Executor* executor = nullptr;
+		bool result = false;
+		std::atomic<bool> done{ false };
+	};
+
+	static void OnSaved(void* state, bool saved)
+	{
+		std::unique_ptr<std::shared_ptr<Completion>> owner(static_cast<std::shared_ptr<Completion>*>(state));
+		Completion& completion = **owner;
+
+		if (completion.done.exchange(true))
+		{
+			return;
+		}
+
+		completion.result = saved;
+		ResumeOn(completion.executor, completion.coroutine);
+	}
+
+	SaveOperation operation;
+	std::shared_ptr<Completion> completion;
+};
+
+inline ChangeAwaiter operator co_await(ChangeSubscription subscription)
+{
+	return ChangeAwaiter(std::move(subscription));
+}
+
+inline LoadAwaiter operator co_await(LoadOperation operation)
+{
+	return LoadAwaiter(std::move(operation));
+}
+
+inline SaveAwaiter operator co_await(SaveOperation operation)
+{
+	return SaveAwaiter(std::move(operation));
+}
@@ -6,17 +6,68 @@
 #include "DataContainer.h"
 #include "ValueConverter.h"
 #include "ChangeNotification.h"
+#include "NativeBindingTable.h"
+#include "SchemaBinding.h"
+#include "PathIndex.h"
+#include "QueryWalker.h"
+
+/// <summary>
+/// Holds managed Blob for the native Blob handle
+/// </summary>
+class BlobWrapper
+{
+public:
+	BlobWrapper(System::Configuration::Blob^ instance) : instance(instance) {}
+
+	msclr::gcroot<System::Configuration::Blob^> instance;
+};
+
+template <>
+class ValueConverter<BlobWrapper>
+{
+public:
+	static System::Object^ GetManaged(BlobWrapper& unmanaged)
+	{
+		return unmanaged.instance;
+	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, BlobWrapper& unmanaged)
+	{
+		System::Configuration::Blob^ blob = dynamic_cast<System::Configuration::Blob^>(dataObject->GetValue());
+
+		if (blob == nullptr)
+		{
+			return false;
+		}
+
+		unmanaged.instance = blob;
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, BlobWrapper& unmanaged)
+	{
+		return dataObject->SetValue(unmanaged.instance);
+	}
+};
 
 class DataContainerWrapper
 {
 public:
 	DataContainerWrapper();
 	DataContainerWrapper(System::Configuration::IDataContainer^ instance);
+	DataContainerWrapper(const DataContainerWrapper& other);
+	DataContainerWrapper& operator=(const DataContainerWrapper& other);
+	~DataContainerWrapper();
 
 	std::vector<std::string> GetKeys();
 
 	static DataContainerWrapper* LoadFromXml(std::string path);
+	static DataContainerWrapper* LoadFromXml(std::string path, bool useCache);
+	static DataContainerWrapper* LoadFromXml(std::string path, const SchemaDescriptor& schema, std::vector<SchemaMismatch>& mismatches);
 	static DataContainerWrapper* LoadFromBinary(std::string path);
+	static DataContainerWrapper* LoadFromCompressedBinary(std::string path, const std::vector<std::string>& keys);
+	static DataContainerWrapper* LoadFromJson(std::string path);
+	static DataContainerWrapper* LoadDirectory(std::string path, std::string pattern, std::vector<LoadError>& errors);
 	
 	bool SaveAsXml(std::string path);
 	bool SaveAsXml();
@@ -24,25 +75,32 @@ public:
 	bool SaveAsBinary(std::string path);
 	bool SaveAsBinary();
 
+	bool SaveAsCompressedBinary(std::string path);
+
+	bool SaveAsJson(std::string path);
+
+	static void BeginLoadFromXml(std::string path, LoadCallback completed, void* state);
+	void BeginSaveAsXml(std::string path, SaveCallback completed, void* state);
+
 	template <typename T>
 	bool GetValue(std::string key, T& value)
 	{
-		System::String^ managedKey = gcnew System::String(key.c_str());
-
-		System::Object^ managedValue = gcnew System::Object();
-		
-		if (instance->GetValue(managedKey, managedValue))
-		{
-			value = ValueConverter<T>::GetUnmanaged(managedValue);
-			return true;
-		}
+		System::Configuration::DataObject^ dataObject = Find(key);
 
-		return false;
+		return dataObject != nullptr && ValueConverter<T>::TryGet(dataObject, value);
 	}
 
 	template <typename T>
 	void PutValue(std::string key, T value)
 	{
+		System::Configuration::DataObject^ dataObject = Find(key);
+
+		if (dataObject != nullptr)
+		{
+			ValueConverter<T>::TrySet(dataObject, value);
+			return;
+		}
+
 		System::String^ managedKey = gcnew System::String(key.c_str());
 
 		System::Configuration::DataContainerExtensions::PutValue(instance, managedKey, ValueConverter<T>::GetManaged(value));
@@ -51,12 +109,18 @@ public:
 	template <typename T>
 	bool SetValue(std::string key, T value)
 	{
-		System::String^ managedKey = gcnew System::String(key.c_str());
+		System::Configuration::DataObject^ dataObject = Find(key);
 
-		return instance->SetValue(managedKey, ValueConverter<T>::GetManaged(value));
+		return dataObject != nullptr && ValueConverter<T>::TrySet(dataObject, value);
 	}
 
-	System::Configuration::IDataContainer^ GetInstance()
+	void Query(std::string pattern, NativeType type, QueryVisitor visitor, void* state)
+	{
+		QueryWalker^ walker = gcnew QueryWalker(gcnew System::String(pattern.c_str()), type, visitor, state);
+		walker->Walk(instance);
+	}
+
+	System::Configuration::IDataContainer^ GetInstance() const
 	{
 		return instance;
 	}
@@ -66,10 +130,105 @@ public:
 		unmanagedListner.SetCallBack(action);
 	}
 
+	WatchHandle Watch(std::string key, bool prefix, ChangeCallback callback, void* state)
+	{
+		return unmanagedListner.Watch(key, prefix, callback, state);
+	}
+
+	bool Unwatch(WatchHandle handle)
+	{
+		return unmanagedListner.Unwatch(handle);
+	}
+
+	BindingHandle Bind(std::string key, const BindingTarget& target)
+	{
+		System::Configuration::DataObject^ dataObject = paths.Find(instance, key);
+
+		if (dataObject == nullptr)
+		{
+			return 0;
+		}
+
+		return bindings.Add(dataObject, target);
+	}
+
+	bool Unbind(BindingHandle handle)
+	{
+		return bindings.Remove(handle);
+	}
+
+	bool Morph(const SchemaDescriptor& schema, void* target)
+	{
+		return schemas.Get(instance, schema)->Morph(target);
+	}
+
+	std::vector<SchemaMismatch> CheckSchema(const SchemaDescriptor& schema)
+	{
+		return schemas.Get(instance, schema)->Mismatches();
+	}
+
+	void FromObject(const SchemaDescriptor& schema, const void* source)
+	{
+		const char* base = static_cast<const char*>(source);
+
+		for (size_t i = 0; i < schema.count; i++)
+		{
+			const SchemaField& field = schema.fields[i];
+
+			PutValueRecursive(gcnew System::String(field.key), ToManaged(field.type, base + field.offset));
+		}
+	}
+
 private:
+	/// <summary>
+	/// Finds DataObject for key through the path index, walking the tree only if it's not indexed
+	/// </summary>
+	System::Configuration::DataObject^ Find(const std::string& key)
+	{
+		System::Configuration::DataObject^ dataObject = paths.Find(instance, key);
+
+		if (dataObject == nullptr)
+		{
+			dataObject = System::Configuration::DataContainerExtensions::FindRecursive(instance, gcnew System::String(key.c_str()));
+		}
+
+		return dataObject;
+	}
+
+	/// <summary>
+	/// PutValue that creates missing nested containers for keys like A.B.C
+	/// </summary>
+	void PutValueRecursive(System::String^ key, System::Object^ value)
+	{
+		array<System::String^>^ split = key->Split('.');
+		System::Configuration::IDataContainer^ container = instance;
+
+		for (int i = 0; i < split->Length - 1; i++)
+		{
+			System::Configuration::DataObject^ parent = container->Find(split[i]);
+			System::Configuration::IDataContainer^ child = parent == nullptr
+				? nullptr
+				: dynamic_cast<System::Configuration::IDataContainer^>(parent->GetValue());
+
+			if (child == nullptr)
+			{
+				child = gcnew System::Configuration::DataContainer();
+				child->Name = split[i];
+				System::Configuration::DataContainerExtensions::PutValue(container, split[i], child);
+			}
+
+			container = child;
+		}
+
+		System::Configuration::DataContainerExtensions::PutValue(container, split[split->Length - 1], value);
+	}
+
 	msclr::gcroot<System::Configuration::IDataContainer^> instance;
 	msclr::gcroot<PropertyChangedListener^> listner;
 	UnmanagedPropertyChangedListener unmanagedListner;
+	NativeBindingTable bindings;
+	SchemaCache schemas;
+	PathIndex paths;
 };
 
 template <>
@@ -93,5 +252,23 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, DataContainerWrapper& unmanaged)
+	{
+		System::Configuration::IDataContainer^ dc = dynamic_cast<System::Configuration::IDataContainer^>(dataObject->GetValue());
+
+		if (dc == nullptr)
+		{
+			return false;
+		}
+
+		unmanaged = DataContainerWrapper(dc);
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, DataContainerWrapper& unmanaged)
+	{
+		return dataObject->SetValue(unmanaged.GetInstance());
+	}
 };
 
@@ -0,0 +1,178 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <type_traits>
+
+struct Duration;
+struct Point;
+struct Color;
+
+/// <summary>
+/// Identifies a native binding registered with DataContainer::Bind, 0 is never a valid handle
+/// </summary>
+typedef uint64_t BindingHandle;
+
+/// <summary>
+/// Type tags for the values that can cross the native/managed boundary
+/// </summary>
+enum class NativeType : uint8_t
+{
+	None,
+	String,
+	Bool,
+	UInt16,
+	UInt32,
+	UInt64,
+	Int16,
+	Int32,
+	Int64,
+	Float,
+	Double,
+	DateTime,
+	TimeSpan,
+	Point,
+	Color
+};
+
+template <typename T>
+struct NativeTypeOf
+{
+	static constexpr NativeType value = NativeType::None;
+};
+
+#define ENABLE_NATIVE_TYPE(_type, _tag)                                  \
+template <>                                                              \
+struct NativeTypeOf<_type>                                               \
+{                                                                        \
+	static constexpr NativeType value = NativeType::_tag;                \
+};                                                                       \
+
+ENABLE_NATIVE_TYPE(std::string, String)
+ENABLE_NATIVE_TYPE(bool, Bool)
+ENABLE_NATIVE_TYPE(uint16_t, UInt16)
+ENABLE_NATIVE_TYPE(uint32_t, UInt32)
+ENABLE_NATIVE_TYPE(uint64_t, UInt64)
+ENABLE_NATIVE_TYPE(int16_t, Int16)
+ENABLE_NATIVE_TYPE(int32_t, Int32)
+ENABLE_NATIVE_TYPE(int64_t, Int64)
+ENABLE_NATIVE_TYPE(float, Float)
+ENABLE_NATIVE_TYPE(double, Double)
+ENABLE_NATIVE_TYPE(tm, DateTime)
+ENABLE_NATIVE_TYPE(Duration, TimeSpan)
+ENABLE_NATIVE_TYPE(Point, Point)
+ENABLE_NATIVE_TYPE(Color, Color)
+
+/// <summary>
+/// Type erased description of native memory a value can be written in to.
+/// write receives the address and a pointer to a value of the type described by type.
+/// </summary>
+struct BindingTarget
+{
+	void* address;
+	NativeType type;
+	void (*write)(void* address, const void* value);
+};
+
+/// <summary>
+/// Versioned double buffer, lets a single writer publish values to any number
+/// of reader threads without locking. Read retries if a write raced with it.
+/// version is odd while a write is in progress, the write after it goes to the other buffer
+/// so readers only retry when a second write reached the buffer they were reading.
+/// </summary>
+template <typename T>
+class DoubleBuffered
+{
+	static_assert(std::is_trivially_copyable<T>::value, "DoubleBuffered requires a trivially copyable type");
+
+public:
+	T Read() const
+	{
+		for (;;)
+		{
+			uint32_t before = version.load(std::memory_order_acquire);
+			T value = buffers[(before >> 1) & 1];
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			// the buffer read is only written again by the write after next, which first sets version to (before | 1) + 2
+			if (version.load(std::memory_order_relaxed) - (before & ~1u) < 3)
+			{
+				return value;
+			}
+		}
+	}
+
+	void Write(const T& value)
+	{
+		uint32_t current = version.load(std::memory_order_relaxed);
+
+		version.store(current + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		buffers[((current >> 1) + 1) & 1] = value;
+
+		version.store(current + 2, std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Number of completed writes
+	/// </summary>
+	uint32_t Version() const
+	{
+		return version.load(std::memory_order_acquire) / 2;
+	}
+
+private:
+	T buffers[2]{};
+	std::atomic<uint32_t> version{ 0 };
+};
+
+template <typename T>
+BindingTarget MakeBindingTarget(T* target)
+{
+	static_assert(NativeTypeOf<T>::value != NativeType::None, "Type is not supported by DataContainer");
+
+	return BindingTarget{ target, NativeTypeOf<T>::value, [](void* address, const void* value)
+	{
+		*static_cast<T*>(address) = *static_cast<const T*>(value);
+	} };
+}
+
+template <typename T>
+BindingTarget MakeBindingTarget(std::atomic<T>* target)
+{
+	static_assert(std::is_arithmetic<T>::value, "Atomic bindings are only supported for arithmetic types");
+
+	return BindingTarget{ target, NativeTypeOf<T>::value, [](void* address, const void* value)
+	{
+		static_cast<std::atomic<T>*>(address)->store(*static_cast<const T*>(value), std::memory_order_release);
+	} };
+}
+
+template <typename T>
+BindingTarget MakeBindingTarget(DoubleBuffered<T>* target)
+{
+	static_assert(NativeTypeOf<T>::value != NativeType::None, "Type is not supported by DataContainer");
+
+	return BindingTarget{ target, NativeTypeOf<T>::value, [](void* address, const void* value)
+	{
+		static_cast<DoubleBuffered<T>*>(address)->Write(*static_cast<const T*>(value));
+	} };
+}
+
+/// <summary>
+/// Key relative to a prefix and the native memory it should be written to,
+/// used to bind several fields of a struct in one call.
+/// </summary>
+struct FieldBinding
+{
+	std::string key;
+	BindingTarget target;
+};
+
+template <typename T>
+FieldBinding Field(std::string key, T* target)
+{
+	return FieldBinding{ key, MakeBindingTarget(target) };
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include <vector>
+#include <msclr/gcroot.h>
+#include "NativeBinding.h"
+#include "ValueConverter.h"
+
+#define WRITE_NATIVE(_tag, _type)                                        \
+case NativeType::_tag:                                                   \
+{                                                                        \
+	_type value = ValueConverter<_type>::GetUnmanaged(managed);          \
+	write(address, &value);                                              \
+	break;                                                               \
+}                                                                        \
+
+/// <summary>
+/// Binding between a DataObject and native memory, native counterpart of DataObjectBinding.
+/// Listens to the DataObject directly so changes are pushed without looking up the key again.
+/// </summary>
+ref class NativeDataObjectBinding
+{
+public:
+	NativeDataObjectBinding(System::Configuration::DataObject^ dataObject, const BindingTarget& target)
+	{
+		this->dataObject = dataObject;
+		address = target.address;
+		type = target.type;
+		write = target.write;
+
+		UpdateTarget();
+
+		handler = gcnew System::ComponentModel::PropertyChangedEventHandler(this, &NativeDataObjectBinding::OnPropertyChanged);
+		dataObject->PropertyChanged += handler;
+	}
+
+	void Detach()
+	{
+		dataObject->PropertyChanged -= handler;
+	}
+
+	void OnPropertyChanged(System::Object^ sender, System::ComponentModel::PropertyChangedEventArgs^ e)
+	{
+		if (System::String::Equals(e->PropertyName, "Value"))
+		{
+			UpdateTarget();
+		}
+	}
+
+	void UpdateTarget()
+	{
+		System::Object^ managed = dataObject->GetValue();
+
+		switch (type)
+		{
+			NATIVE_TYPE_SWITCH(WRITE_NATIVE)
+		default:
+			break;
+		}
+	}
+
+private:
+	System::Configuration::DataObject^ dataObject;
+	System::ComponentModel::PropertyChangedEventHandler^ handler;
+	void* address;
+	NativeType type;
+	void (*write)(void* address, const void* value);
+};
+
+#undef WRITE_NATIVE
+
+/// <summary>
+/// Slot table holding native bindings of a container.
+/// Handles encode slot index and generation, so adding and removing are O(1)
+/// and a stale handle can never remove a binding that reused its slot.
+/// Bindings belong to the instance that registered them and are not copied.
+/// </summary>
+class NativeBindingTable
+{
+public:
+	NativeBindingTable() = default;
+
+	NativeBindingTable(const NativeBindingTable&)
+	{
+	}
+
+	NativeBindingTable& operator=(const NativeBindingTable&)
+	{
+		return *this;
+	}
+
+	~NativeBindingTable()
+	{
+		for (auto& slot : slots)
+		{
+			if (static_cast<NativeDataObjectBinding^>(slot.binding) != nullptr)
+			{
+				slot.binding->Detach();
+			}
+		}
+	}
+
+	BindingHandle Add(System::Configuration::DataObject^ dataObject, const BindingTarget& target)
+	{
+		uint32_t index;
+
+		if (freeHead != NoSlot)
+		{
+			index = freeHead;
+			freeHead = slots[index].nextFree;
+		}
+		else
+		{
+			index = static_cast<uint32_t>(slots.size());
+			slots.push_back(Slot());
+		}
+
+		Slot& slot = slots[index];
+		slot.binding = gcnew NativeDataObjectBinding(dataObject, target);
+		slot.nextFree = NoSlot;
+
+		return (static_cast<uint64_t>(slot.generation) << 32) | (index + 1);
+	}
+
+	bool Remove(BindingHandle handle)
+	{
+		uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFF) - 1;
+		uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+		if (handle == 0 || index >= slots.size())
+		{
+			return false;
+		}
+
+		Slot& slot = slots[index];
+
+		if (slot.generation != generation || static_cast<NativeDataObjectBinding^>(slot.binding) == nullptr)
+		{
+			return false;
+		}
+
+		slot.binding->Detach();
+		slot.binding = nullptr;
+		slot.generation++;
+		slot.nextFree = freeHead;
+		freeHead = index;
+
+		return true;
+	}
+
+private:
+	static const uint32_t NoSlot = 0xFFFFFFFF;
+
+	struct Slot
+	{
+		msclr::gcroot<NativeDataObjectBinding^> binding;
+		uint32_t generation = 0;
+		uint32_t nextFree = NoSlot;
+	};
+
+	std::vector<Slot> slots;
+	uint32_t freeHead = NoSlot;
+};
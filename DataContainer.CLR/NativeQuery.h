@@ -0,0 +1,9 @@
+#pragma once
+#include <string>
+
+struct QueryValue;
+
+/// <summary>
+/// Called once for every value matched by DataContainer::Query, key is the full key of the value
+/// </summary>
+typedef void (*QueryVisitor)(void* state, const std::string& key, const QueryValue& value);
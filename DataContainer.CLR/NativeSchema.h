@@ -0,0 +1,99 @@
+#pragma once
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "NativeBinding.h"
+
+/// <summary>
+/// FNV-1a hash of a key, usable at compile time
+/// </summary>
+constexpr uint64_t SchemaHash(const char* key)
+{
+	uint64_t hash = 14695981039346656037ull;
+
+	while (*key)
+	{
+		hash ^= static_cast<uint8_t>(*key++);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+template <typename T>
+constexpr NativeType SchemaTypeOf()
+{
+	static_assert(NativeTypeOf<T>::value != NativeType::None, "Type is not supported by DataContainer");
+
+	return NativeTypeOf<T>::value;
+}
+
+template <typename T>
+void SchemaWrite(void* address, const void* value)
+{
+	*static_cast<T*>(address) = *static_cast<const T*>(value);
+}
+
+/// <summary>
+/// Describes one field of a native struct, key is relative to the container being mapped
+/// and can contain '.' to reach in to nested containers.
+/// </summary>
+struct SchemaField
+{
+	const char* key;
+	size_t offset;
+	NativeType type;
+	void (*write)(void* address, const void* value);
+};
+
+/// <summary>
+/// Compile time description of a native struct, see DATACONTAINER_SCHEMA
+/// </summary>
+struct SchemaDescriptor
+{
+	const char* name;
+	uint64_t hash;
+	const SchemaField* fields;
+	size_t count;
+};
+
+enum class SchemaError : uint8_t
+{
+	MissingKey,
+	TypeMismatch
+};
+
+struct SchemaMismatch
+{
+	std::string key;
+	SchemaError error;
+};
+
+/// <summary>
+/// Specialized for every struct described with DATACONTAINER_SCHEMA
+/// </summary>
+template <typename T>
+struct Schema;
+
+/// <summary>
+/// Describes the fields of a struct to DataContainer, must be used in the global namespace.
+///
+/// DATACONTAINER_SCHEMA(AxisConfig,
+///     SCHEMA_FIELD(speed, "Speed"),
+///     SCHEMA_FIELD(acceleration, "Acceleration"))
+/// </summary>
+#define DATACONTAINER_SCHEMA(_type, ...)                                                                    \
+template <>                                                                                                 \
+struct Schema<_type>                                                                                        \
+{                                                                                                           \
+	typedef _type Type;                                                                                     \
+	static const SchemaDescriptor& Descriptor()                                                             \
+	{                                                                                                       \
+		static constexpr SchemaField fields[] = { __VA_ARGS__ };                                            \
+		static constexpr SchemaDescriptor descriptor = { #_type, SchemaHash(#_type), fields, sizeof(fields) / sizeof(fields[0]) }; \
+		return descriptor;                                                                                  \
+	}                                                                                                       \
+};                                                                                                          \
+
+#define SCHEMA_FIELD(_member, _key)                                                                         \
+SchemaField{ _key, offsetof(Type, _member), SchemaTypeOf<decltype(Type::_member)>(), &SchemaWrite<decltype(Type::_member)> }
@@ -0,0 +1,315 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <msclr/gcroot.h>
+#include "ValueConverter.h"
+
+class PathIndex;
+
+/// <summary>
+/// Listens to one container of the indexed tree, and to the DataObject holding it,
+/// and forwards changes to PathIndex with the path of the container.
+/// </summary>
+ref class PathIndexListener
+{
+public:
+	PathIndexListener(PathIndex* index, const std::string& path, System::Configuration::IDataContainer^ container, System::Configuration::DataObject^ owner)
+	{
+		this->index = index;
+		this->path = new std::string(path);
+		this->container = container;
+		this->owner = owner;
+
+		collectionHandler = gcnew System::Collections::Specialized::NotifyCollectionChangedEventHandler(this, &PathIndexListener::OnCollectionChanged);
+		container->CollectionChanged += collectionHandler;
+
+		if (owner != nullptr)
+		{
+			ownerHandler = gcnew System::ComponentModel::PropertyChangedEventHandler(this, &PathIndexListener::OnOwnerChanged);
+			owner->PropertyChanged += ownerHandler;
+		}
+	}
+
+	~PathIndexListener()
+	{
+		this->!PathIndexListener();
+	}
+
+	!PathIndexListener()
+	{
+		delete path;
+		path = nullptr;
+	}
+
+	void Detach()
+	{
+		container->CollectionChanged -= collectionHandler;
+
+		if (owner != nullptr)
+		{
+			owner->PropertyChanged -= ownerHandler;
+		}
+	}
+
+private:
+	void OnCollectionChanged(System::Object^ sender, System::Collections::Specialized::NotifyCollectionChangedEventArgs^ e);
+	void OnOwnerChanged(System::Object^ sender, System::ComponentModel::PropertyChangedEventArgs^ e);
+
+	PathIndex* index;
+	std::string* path;
+	System::Configuration::IDataContainer^ container;
+	System::Configuration::DataObject^ owner;
+	System::Collections::Specialized::NotifyCollectionChangedEventHandler^ collectionHandler;
+	System::ComponentModel::PropertyChangedEventHandler^ ownerHandler;
+};
+
+/// <summary>
+/// Flattened index of every DataObject in a container tree keyed by its full dotted path,
+/// so a nested key is resolved with one hash lookup instead of a walk through every level.
+/// Built on first use and kept up to date incrementally as containers are added, removed or replaced.
+/// Like NativeBindingTable it belongs to the instance that built it, copies start empty.
+/// </summary>
+class PathIndex
+{
+public:
+	PathIndex() = default;
+
+	PathIndex(const PathIndex&)
+	{
+	}
+
+	PathIndex& operator=(const PathIndex&)
+	{
+		// the owning wrapper may now point to another container
+		Clear();
+		return *this;
+	}
+
+	~PathIndex()
+	{
+		Clear();
+	}
+
+	/// <summary>
+	/// Finds DataObject for full key, nullptr if there is none
+	/// </summary>
+	System::Configuration::DataObject^ Find(System::Configuration::IDataContainer^ root, const std::string& key)
+	{
+		if (!built)
+		{
+			if (root == nullptr)
+			{
+				return nullptr;
+			}
+
+			AddContainer(std::string(), root, nullptr);
+			built = true;
+		}
+
+		auto it = entries.find(key);
+
+		return it == entries.end() ? nullptr : static_cast<System::Configuration::DataObject^>(it->second);
+	}
+
+	void Clear()
+	{
+		for (auto& node : nodes)
+		{
+			node.second.listener->Detach();
+			delete static_cast<PathIndexListener^>(node.second.listener);
+		}
+
+		nodes.clear();
+		entries.clear();
+		built = false;
+	}
+
+	void OnAdded(const std::string& path, System::Configuration::DataObject^ dataObject)
+	{
+		auto node = nodes.find(path);
+
+		if (node == nodes.end())
+		{
+			return;
+		}
+
+		std::string name = ValueConverter<std::string>::GetUnmanaged(dataObject->Name);
+		node->second.children.push_back(name);
+
+		AddEntry(Join(path, name), dataObject);
+	}
+
+	void OnRemoved(const std::string& path, System::Configuration::DataObject^ dataObject)
+	{
+		auto node = nodes.find(path);
+
+		if (node == nodes.end())
+		{
+			return;
+		}
+
+		std::string name = ValueConverter<std::string>::GetUnmanaged(dataObject->Name);
+		std::vector<std::string>& children = node->second.children;
+
+		for (size_t i = 0; i < children.size(); i++)
+		{
+			if (children[i] == name)
+			{
+				children[i] = children.back();
+				children.pop_back();
+				break;
+			}
+		}
+
+		RemoveEntry(Join(path, name));
+	}
+
+	/// <summary>
+	/// Reindexes container at path from its current contents,
+	/// path is taken by value because the listener owning it is replaced.
+	/// </summary>
+	void OnReset(std::string path)
+	{
+		auto node = nodes.find(path);
+
+		if (node == nodes.end())
+		{
+			return;
+		}
+
+		System::Configuration::IDataContainer^ container = node->second.container;
+		System::Configuration::DataObject^ owner = node->second.owner;
+
+		RemoveContainer(path);
+		AddContainer(path, container, owner);
+	}
+
+	/// <summary>
+	/// DataObject at path now holds a different value, reindexes everything below it
+	/// </summary>
+	void OnReplaced(std::string path)
+	{
+		auto node = nodes.find(path);
+
+		if (node == nodes.end())
+		{
+			return;
+		}
+
+		System::Configuration::DataObject^ owner = node->second.owner;
+
+		RemoveContainer(path);
+
+		if (System::Configuration::IDataContainer^ container = dynamic_cast<System::Configuration::IDataContainer^>(owner->GetValue()))
+		{
+			AddContainer(path, container, owner);
+		}
+	}
+
+private:
+	struct Node
+	{
+		msclr::gcroot<PathIndexListener^> listener;
+		msclr::gcroot<System::Configuration::IDataContainer^> container;
+		msclr::gcroot<System::Configuration::DataObject^> owner;
+		std::vector<std::string> children;
+	};
+
+	static std::string Join(const std::string& path, const std::string& name)
+	{
+		return path.empty() ? name : path + "." + name;
+	}
+
+	void AddEntry(const std::string& path, System::Configuration::DataObject^ dataObject)
+	{
+		entries[path] = dataObject;
+
+		if (System::Configuration::IDataContainer^ container = dynamic_cast<System::Configuration::IDataContainer^>(dataObject->GetValue()))
+		{
+			AddContainer(path, container, dataObject);
+		}
+	}
+
+	void RemoveEntry(const std::string& path)
+	{
+		entries.erase(path);
+		RemoveContainer(path);
+	}
+
+	void AddContainer(const std::string& path, System::Configuration::IDataContainer^ container, System::Configuration::DataObject^ owner)
+	{
+		RemoveContainer(path);
+
+		Node& node = nodes[path];
+		node.listener = gcnew PathIndexListener(this, path, container, owner);
+		node.container = container;
+		node.owner = owner;
+
+		for each (System::Configuration::DataObject ^ dataObject in container)
+		{
+			std::string name = ValueConverter<std::string>::GetUnmanaged(dataObject->Name);
+			node.children.push_back(name);
+
+			AddEntry(Join(path, name), dataObject);
+		}
+	}
+
+	/// <summary>
+	/// Removes everything below path, path itself is kept
+	/// </summary>
+	void RemoveContainer(const std::string& path)
+	{
+		auto node = nodes.find(path);
+
+		if (node == nodes.end())
+		{
+			return;
+		}
+
+		std::vector<std::string> children = std::move(node->second.children);
+
+		node->second.listener->Detach();
+		delete static_cast<PathIndexListener^>(node->second.listener);
+		nodes.erase(node);
+
+		for (const std::string& child : children)
+		{
+			RemoveEntry(Join(path, child));
+		}
+	}
+
+	std::unordered_map<std::string, msclr::gcroot<System::Configuration::DataObject^>> entries;
+	std::unordered_map<std::string, Node> nodes;
+	bool built = false;
+};
+
+inline void PathIndexListener::OnCollectionChanged(System::Object^ sender, System::Collections::Specialized::NotifyCollectionChangedEventArgs^ e)
+{
+	switch (e->Action)
+	{
+	case System::Collections::Specialized::NotifyCollectionChangedAction::Add:
+		for each (System::Configuration::DataObject ^ dataObject in e->NewItems)
+		{
+			index->OnAdded(*path, dataObject);
+		}
+		break;
+	case System::Collections::Specialized::NotifyCollectionChangedAction::Remove:
+		for each (System::Configuration::DataObject ^ dataObject in e->OldItems)
+		{
+			index->OnRemoved(*path, dataObject);
+		}
+		break;
+	default:
+		index->OnReset(*path);
+		break;
+	}
+}
+
+inline void PathIndexListener::OnOwnerChanged(System::Object^ sender, System::ComponentModel::PropertyChangedEventArgs^ e)
+{
+	if (System::String::Equals(e->PropertyName, "Value"))
+	{
+		index->OnReplaced(*path);
+	}
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include <string>
+#include "DataContainer.h"
+#include "ValueConverter.h"
+
+/// <summary>
+/// Walks a container tree once for a pattern like "*.Axis*.Speed" or "Theme.**".
+/// Segments are separated by '.', '*' and '?' match within a segment and "**" matches any number of segments.
+/// Literal segments are looked up directly, so subtrees that cannot match are never visited.
+/// </summary>
+ref class QueryWalker
+{
+public:
+	QueryWalker(System::String^ pattern, NativeType type, QueryVisitor visitor, void* state)
+	{
+		System::Collections::Generic::List<System::String^>^ compiled = gcnew System::Collections::Generic::List<System::String^>();
+
+		for each (System::String ^ segment in pattern->Split('.'))
+		{
+			// consecutive "**" match the same keys as one
+			if (System::String::Equals(segment, AnyDepth) && compiled->Count > 0 && System::String::Equals(compiled[compiled->Count - 1], AnyDepth))
+			{
+				continue;
+			}
+
+			compiled->Add(segment);
+		}
+
+		segments = compiled->ToArray();
+		path = gcnew System::Collections::Generic::List<System::String^>();
+
+		// with more than one "**" a container can be reached at the same segment along several paths
+		if (compiled->FindAll(gcnew System::Predicate<System::String^>(&QueryWalker::IsAnyDepth))->Count > 1)
+		{
+			visited = gcnew System::Collections::Generic::HashSet<System::String^>();
+		}
+
+		this->type = type;
+		this->visitor = visitor;
+		this->state = state;
+	}
+
+	void Walk(System::Configuration::IDataContainer^ container)
+	{
+		if (container != nullptr && segments->Length > 0)
+		{
+			Walk(container, 0);
+		}
+	}
+
+private:
+	void Walk(System::Configuration::IDataContainer^ container, int index)
+	{
+		// a container reached again at the same segment would visit the same keys again
+		if (visited != nullptr && !visited->Add(System::String::Concat(index.ToString(), ":", System::String::Join(".", path))))
+		{
+			return;
+		}
+
+		System::String^ segment = segments[index];
+		bool last = index == segments->Length - 1;
+
+		if (System::String::Equals(segment, AnyDepth))
+		{
+			if (!last)
+			{
+				Walk(container, index + 1);
+			}
+
+			for each (System::Configuration::DataObject ^ dataObject in container)
+			{
+				if (last)
+				{
+					Visit(dataObject);
+				}
+
+				Descend(dataObject, index);
+			}
+		}
+		else if (segment->IndexOfAny(Wildcards) < 0)
+		{
+			System::Configuration::DataObject^ dataObject = container->Find(segment);
+
+			if (dataObject != nullptr)
+			{
+				Next(dataObject, index, last);
+			}
+		}
+		else
+		{
+			for each (System::Configuration::DataObject ^ dataObject in container)
+			{
+				if (Match(segment, dataObject->Name))
+				{
+					Next(dataObject, index, last);
+				}
+			}
+		}
+	}
+
+	void Next(System::Configuration::DataObject^ dataObject, int index, bool last)
+	{
+		if (last)
+		{
+			Visit(dataObject);
+		}
+		else
+		{
+			Descend(dataObject, index + 1);
+		}
+	}
+
+	void Descend(System::Configuration::DataObject^ dataObject, int index)
+	{
+		if (System::Configuration::IDataContainer^ child = dynamic_cast<System::Configuration::IDataContainer^>(dataObject->GetValue()))
+		{
+			path->Add(dataObject->Name);
+			Walk(child, index);
+			path->RemoveAt(path->Count - 1);
+		}
+	}
+
+	void Visit(System::Configuration::DataObject^ dataObject)
+	{
+		System::Object^ managed = dataObject->GetValue();
+
+		if (managed == nullptr)
+		{
+			return;
+		}
+
+		NativeType valueType = TypeTagOf(managed->GetType());
+
+		if (valueType == NativeType::None || (type != NativeType::None && valueType != type))
+		{
+			return;
+		}
+
+		QueryValue value;
+		value.type = valueType;
+		ToNative(valueType, managed, value.Address());
+
+		path->Add(dataObject->Name);
+		std::string key = ValueConverter<std::string>::GetUnmanaged(System::String::Join(".", path));
+		path->RemoveAt(path->Count - 1);
+
+		visitor(state, key, value);
+	}
+
+	static bool IsAnyDepth(System::String^ segment)
+	{
+		return System::String::Equals(segment, AnyDepth);
+	}
+
+	static NativeType TypeTagOf(System::Type^ managedType)
+	{
+		for (uint8_t tag = static_cast<uint8_t>(NativeType::String); tag <= static_cast<uint8_t>(NativeType::Color); tag++)
+		{
+			if (ManagedTypeOf(static_cast<NativeType>(tag)) == managedType)
+			{
+				return static_cast<NativeType>(tag);
+			}
+		}
+
+		return NativeType::None;
+	}
+
+	/// <summary>
+	/// Glob match of a single segment, '*' matches any run of characters and '?' a single character
+	/// </summary>
+	static bool Match(System::String^ pattern, System::String^ name)
+	{
+		int p = 0, n = 0, star = -1, resume = 0;
+
+		while (n < name->Length)
+		{
+			if (p < pattern->Length && (pattern[p] == '?' || pattern[p] == name[n]))
+			{
+				p++;
+				n++;
+			}
+			else if (p < pattern->Length && pattern[p] == '*')
+			{
+				star = p++;
+				resume = n;
+			}
+			else if (star >= 0)
+			{
+				p = star + 1;
+				n = ++resume;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		while (p < pattern->Length && pattern[p] == '*')
+		{
+			p++;
+		}
+
+		return p == pattern->Length;
+	}
+
+	static initonly System::String^ AnyDepth = "**";
+	static initonly array<wchar_t>^ Wildcards = gcnew array<wchar_t>{ '*', '?' };
+
+	array<System::String^>^ segments;
+	System::Collections::Generic::List<System::String^>^ path;
+	System::Collections::Generic::HashSet<System::String^>^ visited;
+	NativeType type;
+	QueryVisitor visitor;
+	void* state;
+};
@@ -0,0 +1,224 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include <msclr/gcroot.h>
+#include "NativeSchema.h"
+#include "ValueConverter.h"
+
+/// <summary>
+/// Fields of a SchemaDescriptor resolved to the DataObjects of a container.
+/// Keys are looked up once, after that mapping between the container and a struct
+/// is a loop over the resolved DataObjects and precomputed offsets.
+/// Becomes invalid when any container along the resolved paths changes shape.
+/// </summary>
+ref class SchemaBinding
+{
+public:
+	SchemaBinding(System::Configuration::IDataContainer^ container, const SchemaDescriptor& schema)
+	{
+		fields = schema.fields;
+		count = schema.count;
+		properties = gcnew array<System::Configuration::DataObject^>(static_cast<int>(count));
+		mismatches = new std::vector<SchemaMismatch>();
+		collections = gcnew System::Collections::Generic::List<System::Collections::Specialized::INotifyCollectionChanged^>();
+		parents = gcnew System::Collections::Generic::List<System::Configuration::DataObject^>();
+		collectionHandler = gcnew System::Collections::Specialized::NotifyCollectionChangedEventHandler(this, &SchemaBinding::OnCollectionChanged);
+		parentHandler = gcnew System::ComponentModel::PropertyChangedEventHandler(this, &SchemaBinding::OnParentChanged);
+		valid = true;
+
+		Listen(container);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			System::Configuration::DataObject^ dataObject = Resolve(container, gcnew System::String(fields[i].key));
+
+			if (dataObject == nullptr)
+			{
+				mismatches->push_back(SchemaMismatch{ fields[i].key, SchemaError::MissingKey });
+			}
+			else if (dataObject->GetDataType() != ManagedTypeOf(fields[i].type))
+			{
+				mismatches->push_back(SchemaMismatch{ fields[i].key, SchemaError::TypeMismatch });
+			}
+			else
+			{
+				properties[static_cast<int>(i)] = dataObject;
+			}
+		}
+	}
+
+	~SchemaBinding()
+	{
+		this->!SchemaBinding();
+	}
+
+	!SchemaBinding()
+	{
+		delete mismatches;
+		mismatches = nullptr;
+	}
+
+	property bool IsValid
+	{
+		bool get() { return valid; }
+	}
+
+	const std::vector<SchemaMismatch>& Mismatches()
+	{
+		return *mismatches;
+	}
+
+	/// <summary>
+	/// Copies resolved values in to target, returns false if any field could not be resolved
+	/// </summary>
+	bool Morph(void* target)
+	{
+		char* base = static_cast<char*>(target);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			System::Configuration::DataObject^ dataObject = properties[static_cast<int>(i)];
+
+			if (dataObject != nullptr)
+			{
+				ToNative(fields[i].type, dataObject, base + fields[i].offset);
+			}
+		}
+
+		return mismatches->empty();
+	}
+
+	void Detach()
+	{
+		for each (System::Collections::Specialized::INotifyCollectionChanged ^ collection in collections)
+		{
+			collection->CollectionChanged -= collectionHandler;
+		}
+
+		for each (System::Configuration::DataObject ^ parent in parents)
+		{
+			parent->PropertyChanged -= parentHandler;
+		}
+
+		collections->Clear();
+		parents->Clear();
+		valid = false;
+	}
+
+private:
+	System::Configuration::DataObject^ Resolve(System::Configuration::IDataContainer^ container, System::String^ key)
+	{
+		array<System::String^>^ split = key->Split('.');
+
+		for (int i = 0; i < split->Length - 1; i++)
+		{
+			System::Configuration::DataObject^ parent = container->Find(split[i]);
+
+			if (parent == nullptr)
+			{
+				return nullptr;
+			}
+
+			container = dynamic_cast<System::Configuration::IDataContainer^>(parent->GetValue());
+
+			if (container == nullptr)
+			{
+				return nullptr;
+			}
+
+			if (!parents->Contains(parent))
+			{
+				parent->PropertyChanged += parentHandler;
+				parents->Add(parent);
+			}
+
+			Listen(container);
+		}
+
+		return container->Find(split[split->Length - 1]);
+	}
+
+	void Listen(System::Configuration::IDataContainer^ container)
+	{
+		if (!collections->Contains(container))
+		{
+			container->CollectionChanged += collectionHandler;
+			collections->Add(container);
+		}
+	}
+
+	void OnCollectionChanged(System::Object^ sender, System::Collections::Specialized::NotifyCollectionChangedEventArgs^ e)
+	{
+		Detach();
+	}
+
+	void OnParentChanged(System::Object^ sender, System::ComponentModel::PropertyChangedEventArgs^ e)
+	{
+		if (System::String::Equals(e->PropertyName, "Value"))
+		{
+			Detach();
+		}
+	}
+
+	const SchemaField* fields;
+	size_t count;
+	bool valid;
+	array<System::Configuration::DataObject^>^ properties;
+	std::vector<SchemaMismatch>* mismatches;
+	System::Collections::Generic::List<System::Collections::Specialized::INotifyCollectionChanged^>^ collections;
+	System::Collections::Generic::List<System::Configuration::DataObject^>^ parents;
+	System::Collections::Specialized::NotifyCollectionChangedEventHandler^ collectionHandler;
+	System::ComponentModel::PropertyChangedEventHandler^ parentHandler;
+};
+
+/// <summary>
+/// Resolved schemas of a container keyed by the compile time hash of the schema,
+/// like NativeBindingTable it belongs to the instance that created it and is not copied.
+/// </summary>
+class SchemaCache
+{
+public:
+	SchemaCache() = default;
+
+	SchemaCache(const SchemaCache&)
+	{
+	}
+
+	SchemaCache& operator=(const SchemaCache&)
+	{
+		return *this;
+	}
+
+	~SchemaCache()
+	{
+		for (auto& entry : schemas)
+		{
+			entry.second->Detach();
+			delete static_cast<SchemaBinding^>(entry.second);
+		}
+	}
+
+	SchemaBinding^ Get(System::Configuration::IDataContainer^ container, const SchemaDescriptor& schema)
+	{
+		auto it = schemas.find(schema.hash);
+
+		if (it != schemas.end())
+		{
+			if (it->second->IsValid)
+			{
+				return it->second;
+			}
+
+			delete static_cast<SchemaBinding^>(it->second);
+			schemas.erase(it);
+		}
+
+		SchemaBinding^ binding = gcnew SchemaBinding(container, schema);
+		schemas[schema.hash] = binding;
+
+		return binding;
+	}
+
+private:
+	std::unordered_map<uint64_t, msclr::gcroot<SchemaBinding^>> schemas;
+};
@@ -0,0 +1,541 @@
+#include "SharedContainer.h"
+#include "DataContainer.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace
+{
+	const uint32_t SharedMagic = 0x53434444; // "DDCS"
+	const uint32_t SharedVersion = 1;
+
+	/// <summary>
+	/// How long a read waits for a publish to finish, a publisher that died while writing never does
+	/// </summary>
+	const std::chrono::seconds ReadTimeout(1);
+
+	/// <summary>
+	/// Start of the segment, entries sorted by hash follow it and then the keys and values they point to.
+	/// sequence is odd while a publish is in progress.
+	/// </summary>
+	struct SharedHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		std::atomic<uint64_t> sequence;
+		uint64_t capacity;
+		uint32_t count;
+		uint32_t size;
+	};
+
+	struct SharedEntry
+	{
+		uint64_t hash;
+		uint32_t keyOffset;
+		uint32_t keyLength;
+		uint32_t valueOffset;
+		uint32_t valueLength;
+		NativeType type;
+		uint8_t reserved[7];
+	};
+
+	uint64_t HashKey(const std::string& key)
+	{
+		return SchemaHash(key.c_str());
+	}
+}
+
+/// <summary>
+/// Mapping of a segment in to this process
+/// </summary>
+struct SharedSegment
+{
+	std::string name;
+	uint8_t* base = nullptr;
+	size_t size = 0;
+	bool owner = false;
+
+#ifdef _WIN32
+	HANDLE mapping = nullptr;
+#else
+	int fd = -1;
+#endif
+
+	SharedHeader* Header() const
+	{
+		return reinterpret_cast<SharedHeader*>(base);
+	}
+
+	uint8_t* Data() const
+	{
+		return base + sizeof(SharedHeader);
+	}
+
+	bool Map(const std::string& segmentName, size_t segmentSize, bool create)
+	{
+		name = segmentName;
+		owner = create;
+
+#ifdef _WIN32
+		if (create)
+		{
+			mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+				static_cast<DWORD>(static_cast<uint64_t>(segmentSize) >> 32), static_cast<DWORD>(segmentSize), name.c_str());
+
+			// an existing mapping keeps its size and may still be read, never take it over
+			if (mapping != nullptr && GetLastError() == ERROR_ALREADY_EXISTS)
+			{
+				Unmap();
+				return false;
+			}
+		}
+		else
+		{
+			mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+		}
+
+		if (mapping == nullptr)
+		{
+			return false;
+		}
+
+		base = static_cast<uint8_t*>(MapViewOfFile(mapping, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, 0));
+
+		if (base == nullptr)
+		{
+			Unmap();
+			return false;
+		}
+
+		MEMORY_BASIC_INFORMATION info;
+		VirtualQuery(base, &info, sizeof(info));
+		size = info.RegionSize;
+#else
+		std::string path = name[0] == '/' ? name : "/" + name;
+
+		if (create)
+		{
+			// readers still attached to a segment left by an earlier publisher keep their mapping of it,
+			// resizing it instead could shrink it under them
+			shm_unlink(path.c_str());
+			fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+		}
+		else
+		{
+			fd = shm_open(path.c_str(), O_RDONLY, 0);
+		}
+
+		if (fd < 0)
+		{
+			return false;
+		}
+
+		if (create && ftruncate(fd, static_cast<off_t>(segmentSize)) != 0)
+		{
+			Unmap();
+			return false;
+		}
+
+		struct stat info;
+
+		if (fstat(fd, &info) != 0)
+		{
+			Unmap();
+			return false;
+		}
+
+		size = static_cast<size_t>(info.st_size);
+
+		void* view = mmap(nullptr, size, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+
+		if (view == MAP_FAILED)
+		{
+			Unmap();
+			return false;
+		}
+
+		base = static_cast<uint8_t*>(view);
+#endif
+
+		return true;
+	}
+
+	void Unmap()
+	{
+#ifdef _WIN32
+		if (base)
+		{
+			UnmapViewOfFile(base);
+		}
+
+		if (mapping)
+		{
+			CloseHandle(mapping);
+		}
+
+		mapping = nullptr;
+#else
+		if (base)
+		{
+			munmap(base, size);
+		}
+
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+
+		if (owner)
+		{
+			shm_unlink((name[0] == '/' ? name : "/" + name).c_str());
+		}
+
+		fd = -1;
+#endif
+
+		base = nullptr;
+		size = 0;
+	}
+};
+
+namespace
+{
+	size_t SizeOf(NativeType type)
+	{
+		switch (type)
+		{
+		case NativeType::Bool: return sizeof(bool);
+		case NativeType::UInt16: return sizeof(uint16_t);
+		case NativeType::UInt32: return sizeof(uint32_t);
+		case NativeType::UInt64: return sizeof(uint64_t);
+		case NativeType::Int16: return sizeof(int16_t);
+		case NativeType::Int32: return sizeof(int32_t);
+		case NativeType::Int64: return sizeof(int64_t);
+		case NativeType::Float: return sizeof(float);
+		case NativeType::Double: return sizeof(double);
+		case NativeType::DateTime: return sizeof(tm);
+		case NativeType::TimeSpan: return sizeof(Duration);
+		case NativeType::Point: return sizeof(Point);
+		case NativeType::Color: return sizeof(Color);
+		default: return 0;
+		}
+	}
+
+	/// <summary>
+	/// Finds entry for key, the segment may be written while this runs
+	/// so everything read from it is bounds checked before use.
+	/// </summary>
+	const SharedEntry* FindEntry(const SharedSegment* segment, const std::string& key, uint64_t hash)
+	{
+		const SharedHeader* header = segment->Header();
+		const uint8_t* data = segment->Data();
+		size_t available = segment->size - sizeof(SharedHeader);
+		size_t count = header->count;
+
+		if (count > available / sizeof(SharedEntry))
+		{
+			return nullptr;
+		}
+
+		const SharedEntry* entries = reinterpret_cast<const SharedEntry*>(data);
+		const SharedEntry* first = std::lower_bound(entries, entries + count, hash,
+			[](const SharedEntry& entry, uint64_t value) { return entry.hash < value; });
+
+		for (const SharedEntry* entry = first; entry != entries + count && entry->hash == hash; entry++)
+		{
+			if (static_cast<size_t>(entry->keyOffset) + entry->keyLength > available
+				|| static_cast<size_t>(entry->valueOffset) + entry->valueLength > available)
+			{
+				return nullptr;
+			}
+
+			if (entry->keyLength == key.size() && std::memcmp(data + entry->keyOffset, key.data(), key.size()) == 0)
+			{
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/// <summary>
+	/// Runs read until no publish raced with it, gives up and returns false after ReadTimeout
+	/// </summary>
+	template <typename Read>
+	bool ReadConsistent(const SharedSegment* segment, Read read)
+	{
+		const SharedHeader* header = segment->Header();
+		std::chrono::steady_clock::time_point deadline{};
+
+		for (;;)
+		{
+			uint64_t before = header->sequence.load(std::memory_order_acquire);
+
+			if ((before & 1) == 0)
+			{
+				bool found = read();
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				if (header->sequence.load(std::memory_order_relaxed) == before)
+				{
+					return found;
+				}
+			}
+
+			// the clock is only read once a read had to be retried
+			auto now = std::chrono::steady_clock::now();
+
+			if (deadline == std::chrono::steady_clock::time_point{})
+			{
+				deadline = now + ReadTimeout;
+			}
+			else if (now > deadline)
+			{
+				return false;
+			}
+
+			std::this_thread::yield();
+		}
+	}
+}
+
+SharedContainerPublisher::SharedContainerPublisher() : segment(nullptr)
+{
+}
+
+SharedContainerPublisher::~SharedContainerPublisher()
+{
+	Close();
+}
+
+bool SharedContainerPublisher::Create(std::string name, size_t capacity)
+{
+	Close();
+
+	segment = new SharedSegment();
+
+	if (!segment->Map(name, sizeof(SharedHeader) + capacity, true))
+	{
+		Close();
+		return false;
+	}
+
+	SharedHeader* header = segment->Header();
+	header->magic = SharedMagic;
+	header->version = SharedVersion;
+	header->sequence.store(0, std::memory_order_relaxed);
+	header->capacity = capacity;
+	header->count = 0;
+	header->size = 0;
+
+	return true;
+}
+
+bool SharedContainerPublisher::Publish(DataContainer& container)
+{
+	if (segment == nullptr)
+	{
+		return false;
+	}
+
+	std::vector<QueryMatch> matches = container.Query("**");
+	std::vector<SharedEntry> entries;
+	entries.reserve(matches.size());
+
+	for (const QueryMatch& match : matches)
+	{
+		SharedEntry entry{};
+		entry.hash = HashKey(match.key);
+		entry.type = match.value.type;
+		entries.push_back(entry);
+	}
+
+	std::vector<size_t> order(matches.size());
+
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		order[i] = i;
+	}
+
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return entries[a].hash < entries[b].hash; });
+
+	// lay out entries followed by their keys and values
+	std::vector<uint8_t> data(order.size() * sizeof(SharedEntry));
+
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		const QueryMatch& match = matches[order[i]];
+		SharedEntry& entry = entries[order[i]];
+
+		const void* value = match.value.type == NativeType::String ? match.value.stringValue.data() : match.value.Address();
+		size_t valueLength = match.value.type == NativeType::String ? match.value.stringValue.size() : SizeOf(match.value.type);
+
+		entry.keyOffset = static_cast<uint32_t>(data.size());
+		entry.keyLength = static_cast<uint32_t>(match.key.size());
+		data.insert(data.end(), match.key.begin(), match.key.end());
+
+		entry.valueOffset = static_cast<uint32_t>(data.size());
+		entry.valueLength = static_cast<uint32_t>(valueLength);
+		data.insert(data.end(), static_cast<const uint8_t*>(value), static_cast<const uint8_t*>(value) + valueLength);
+
+		std::memcpy(data.data() + i * sizeof(SharedEntry), &entry, sizeof(SharedEntry));
+	}
+
+	SharedHeader* header = segment->Header();
+
+	if (data.size() > header->capacity)
+	{
+		return false;
+	}
+
+	uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+
+	header->sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	std::memcpy(segment->Data(), data.data(), data.size());
+	header->count = static_cast<uint32_t>(order.size());
+	header->size = static_cast<uint32_t>(data.size());
+
+	header->sequence.store(sequence + 2, std::memory_order_release);
+
+	return true;
+}
+
+uint64_t SharedContainerPublisher::Generation() const
+{
+	return segment ? segment->Header()->sequence.load(std::memory_order_acquire) / 2 : 0;
+}
+
+void SharedContainerPublisher::Close()
+{
+	if (segment)
+	{
+		segment->Unmap();
+		delete segment;
+		segment = nullptr;
+	}
+}
+
+SharedContainerReader::SharedContainerReader() : segment(nullptr)
+{
+}
+
+SharedContainerReader::~SharedContainerReader()
+{
+	Close();
+}
+
+bool SharedContainerReader::Attach(std::string name)
+{
+	Close();
+
+	segment = new SharedSegment();
+
+	if (!segment->Map(name, 0, false)
+		|| segment->size < sizeof(SharedHeader)
+		|| segment->Header()->magic != SharedMagic
+		|| segment->Header()->version != SharedVersion
+		|| segment->Header()->capacity > segment->size - sizeof(SharedHeader))
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+uint64_t SharedContainerReader::Generation() const
+{
+	return segment ? segment->Header()->sequence.load(std::memory_order_acquire) / 2 : 0;
+}
+
+bool SharedContainerReader::GetValue(const std::string& key, std::string& value) const
+{
+	if (segment == nullptr)
+	{
+		return false;
+	}
+
+	uint64_t hash = HashKey(key);
+	std::string result;
+
+	bool found = ReadConsistent(segment, [&]()
+	{
+		const SharedEntry* entry = FindEntry(segment, key, hash);
+
+		if (entry == nullptr || entry->type != NativeType::String)
+		{
+			return false;
+		}
+
+		result.assign(reinterpret_cast<const char*>(segment->Data() + entry->valueOffset), entry->valueLength);
+		return true;
+	});
+
+	if (found)
+	{
+		value = std::move(result);
+	}
+
+	return found;
+}
+
+bool SharedContainerReader::Read(const std::string& key, NativeType type, void* value, size_t size) const
+{
+	if (segment == nullptr)
+	{
+		return false;
+	}
+
+	uint64_t hash = HashKey(key);
+	alignas(8) uint8_t scratch[64];
+
+	if (size > sizeof(scratch))
+	{
+		return false;
+	}
+
+	bool found = ReadConsistent(segment, [&]()
+	{
+		const SharedEntry* entry = FindEntry(segment, key, hash);
+
+		if (entry == nullptr || entry->type != type || entry->valueLength != size)
+		{
+			return false;
+		}
+
+		std::memcpy(scratch, segment->Data() + entry->valueOffset, size);
+		return true;
+	});
+
+	if (found)
+	{
+		std::memcpy(value, scratch, size);
+	}
+
+	return found;
+}
+
+void SharedContainerReader::Close()
+{
+	if (segment)
+	{
+		segment->Unmap();
+		delete segment;
+		segment = nullptr;
+	}
+}
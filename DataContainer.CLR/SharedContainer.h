@@ -0,0 +1,87 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include "DataContainer.CLR.h"
+#include "NativeBinding.h"
+
+class DataContainer;
+struct SharedSegment;
+
+/// <summary>
+/// Publishes the values of a DataContainer in to a named shared memory segment,
+/// so any number of processes on the host can read them through SharedContainerReader
+/// without holding their own copy of the container.
+/// Only the publishing process needs the managed runtime.
+/// </summary>
+class DATACONTAINER_API SharedContainerPublisher
+{
+public:
+	SharedContainerPublisher();
+	~SharedContainerPublisher();
+
+	SharedContainerPublisher(const SharedContainerPublisher&) = delete;
+	SharedContainerPublisher& operator=(const SharedContainerPublisher&) = delete;
+
+	/// <summary>
+	/// Creates segment with name holding up to capacity bytes of keys and values.
+	/// On Windows this fails while a segment with name is still open, elsewhere an existing one is unlinked
+	/// and processes still attached to it keep reading its last values.
+	/// </summary>
+	bool Create(std::string name, size_t capacity);
+
+	/// <summary>
+	/// Replaces the published values with the current values of container,
+	/// returns false if they don't fit in the segment.
+	/// </summary>
+	bool Publish(DataContainer& container);
+
+	/// <summary>
+	/// Incremented once for every Publish
+	/// </summary>
+	uint64_t Generation() const;
+
+	void Close();
+
+private:
+	SharedSegment* segment;
+};
+
+/// <summary>
+/// Read only view of a segment created by SharedContainerPublisher.
+/// Reads never take a lock, a read that raced with a Publish is retried.
+/// A read still racing after a second fails, so a publisher that died while publishing can't hang readers.
+/// </summary>
+class DATACONTAINER_API SharedContainerReader
+{
+public:
+	SharedContainerReader();
+	~SharedContainerReader();
+
+	SharedContainerReader(const SharedContainerReader&) = delete;
+	SharedContainerReader& operator=(const SharedContainerReader&) = delete;
+
+	bool Attach(std::string name);
+
+	/// <summary>
+	/// Changes whenever values are published, compare with a previous value to poll for changes
+	/// </summary>
+	uint64_t Generation() const;
+
+	bool GetValue(const std::string& key, std::string& value) const;
+
+	template <typename T>
+	bool GetValue(const std::string& key, T& value) const
+	{
+		static_assert(NativeTypeOf<T>::value != NativeType::None, "Type is not supported by DataContainer");
+		static_assert(std::is_trivially_copyable<T>::value, "Type must be trivially copyable");
+
+		return Read(key, NativeTypeOf<T>::value, &value, sizeof(T));
+	}
+
+	void Close();
+
+private:
+	bool Read(const std::string& key, NativeType type, void* value, size_t size) const;
+
+	SharedSegment* segment;
+};
@@ -5,7 +5,7 @@
 #include <typeinfo>
 #include "DataContainer.h"
 
-#define ENABLE_CONVERTSION(_type)                                        \
+#define ENABLE_CONVERTSION(_type, _managed)                              \
 template<>                                                               \
 class ValueConverter<_type>                                              \
 {                                                                        \
@@ -18,6 +18,21 @@ public:							                                         \
 	{                                                                    \
 		return (_type)managed;                                           \
 	}                                                                    \
+	static bool TryGet(System::Configuration::DataObject^ dataObject, _type& unmanaged) \
+	{                                                                    \
+		auto typed = dynamic_cast<System::Configuration::IValueObject<_managed>^>(dataObject); \
+		if (typed == nullptr)                                            \
+		{                                                                \
+			return false;                                                \
+		}                                                                \
+		unmanaged = static_cast<_type>(typed->Value);                    \
+		return true;                                                     \
+	}                                                                    \
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const _type& unmanaged) \
+	{                                                                    \
+		auto typed = dynamic_cast<System::Configuration::IValueObject<_managed>^>(dataObject); \
+		return typed != nullptr && typed->SetValue(static_cast<_managed>(unmanaged)); \
+	}                                                                    \
 };                                                                       \
 
 template <typename _type>
@@ -35,18 +50,28 @@ public:
 		_type r{};
 		return r;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, _type& unmanaged)
+	{
+		return false;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const _type& unmanaged)
+	{
+		return false;
+	}
 };
 
-ENABLE_CONVERTSION(uint16_t)
-ENABLE_CONVERTSION(uint32_t)
-ENABLE_CONVERTSION(uint64_t)
-ENABLE_CONVERTSION(int16_t)
-ENABLE_CONVERTSION(int32_t)
-ENABLE_CONVERTSION(int64_t)
-ENABLE_CONVERTSION(bool)
-ENABLE_CONVERTSION(float)
-ENABLE_CONVERTSION(double)
-ENABLE_CONVERTSION(char)
+ENABLE_CONVERTSION(uint16_t, System::UInt16)
+ENABLE_CONVERTSION(uint32_t, System::UInt32)
+ENABLE_CONVERTSION(uint64_t, System::UInt64)
+ENABLE_CONVERTSION(int16_t, System::Int16)
+ENABLE_CONVERTSION(int32_t, System::Int32)
+ENABLE_CONVERTSION(int64_t, System::Int64)
+ENABLE_CONVERTSION(bool, System::Boolean)
+ENABLE_CONVERTSION(float, System::Single)
+ENABLE_CONVERTSION(double, System::Double)
+ENABLE_CONVERTSION(char, System::Char)
 
 template <>
 class ValueConverter<std::string>
@@ -70,6 +95,25 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, std::string& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::String^>^>(dataObject);
+
+		if (typed == nullptr)
+		{
+			return false;
+		}
+
+		unmanaged = GetUnmanaged(typed->Value);
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const std::string& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::String^>^>(dataObject);
+		return typed != nullptr && typed->SetValue(gcnew System::String(unmanaged.c_str()));
+	}
 };
 
 template <>
@@ -95,6 +139,28 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, Color& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::Configuration::Color>^>(dataObject);
+
+		if (typed == nullptr)
+		{
+			return false;
+		}
+
+		System::Configuration::Color c = typed->Value;
+		unmanaged.r = c.R;
+		unmanaged.g = c.G;
+		unmanaged.b = c.B;
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const Color& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::Configuration::Color>^>(dataObject);
+		return typed != nullptr && typed->SetValue(System::Configuration::Color(unmanaged.r, unmanaged.g, unmanaged.b));
+	}
 };
 
 template <>
@@ -119,6 +185,27 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, Point& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::Configuration::Point>^>(dataObject);
+
+		if (typed == nullptr)
+		{
+			return false;
+		}
+
+		System::Configuration::Point p = typed->Value;
+		unmanaged.x = p.X;
+		unmanaged.y = p.Y;
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const Point& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::Configuration::Point>^>(dataObject);
+		return typed != nullptr && typed->SetValue(System::Configuration::Point(unmanaged.x, unmanaged.y));
+	}
 };
 
 template <>
@@ -146,6 +233,30 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, Duration& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::TimeSpan>^>(dataObject);
+
+		if (typed == nullptr)
+		{
+			return false;
+		}
+
+		System::TimeSpan ts = typed->Value;
+		unmanaged.days = ts.Days;
+		unmanaged.hours = ts.Hours;
+		unmanaged.minutes = ts.Minutes;
+		unmanaged.seconds = ts.Seconds;
+		unmanaged.milliseconds = ts.Milliseconds;
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const Duration& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::TimeSpan>^>(dataObject);
+		return typed != nullptr && typed->SetValue(System::TimeSpan(unmanaged.days, unmanaged.hours, unmanaged.minutes, unmanaged.seconds, unmanaged.milliseconds));
+	}
 };
 
 template <>
@@ -174,6 +285,129 @@ public:
 
 		return result;
 	}
+
+	static bool TryGet(System::Configuration::DataObject^ dataObject, tm& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::DateTime>^>(dataObject);
+
+		if (typed == nullptr)
+		{
+			return false;
+		}
+
+		System::DateTime dt = typed->Value;
+		unmanaged = tm{};
+		unmanaged.tm_year = dt.Year - 1900;
+		unmanaged.tm_mon = dt.Month - 1;
+		unmanaged.tm_mday = dt.Day;
+		unmanaged.tm_hour = dt.Hour;
+		unmanaged.tm_min = dt.Minute;
+		unmanaged.tm_sec = dt.Second;
+		return true;
+	}
+
+	static bool TrySet(System::Configuration::DataObject^ dataObject, const tm& unmanaged)
+	{
+		auto typed = dynamic_cast<System::Configuration::IValueObject<System::DateTime>^>(dataObject);
+		return typed != nullptr && typed->SetValue(System::DateTime(unmanaged.tm_year + 1900, unmanaged.tm_mon + 1, unmanaged.tm_mday, unmanaged.tm_hour, unmanaged.tm_min, unmanaged.tm_sec));
+	}
 };
 
 
+
+#define NATIVE_TYPE_SWITCH(_case)                                        \
+	_case(String, std::string)                                           \
+	_case(Bool, bool)                                                    \
+	_case(UInt16, uint16_t)                                              \
+	_case(UInt32, uint32_t)                                              \
+	_case(UInt64, uint64_t)                                              \
+	_case(Int16, int16_t)                                                \
+	_case(Int32, int32_t)                                                \
+	_case(Int64, int64_t)                                                \
+	_case(Float, float)                                                  \
+	_case(Double, double)                                                \
+	_case(DateTime, tm)                                                  \
+	_case(TimeSpan, Duration)                                            \
+	_case(Point, Point)                                                  \
+	_case(Color, Color)                                                  \
+
+#define TO_NATIVE_CASE(_tag, _type)                                      \
+	case NativeType::_tag:                                               \
+		*static_cast<_type*>(address) = ValueConverter<_type>::GetUnmanaged(managed); \
+		break;                                                           \
+
+#define TO_MANAGED_CASE(_tag, _type)                                     \
+	case NativeType::_tag:                                               \
+	{                                                                    \
+		_type value = *static_cast<const _type*>(address);               \
+		return ValueConverter<_type>::GetManaged(value);                 \
+	}                                                                    \
+
+/// <summary>
+/// Writes managed value in to native memory holding the type described by type
+/// </summary>
+inline void ToNative(NativeType type, System::Object^ managed, void* address)
+{
+	switch (type)
+	{
+		NATIVE_TYPE_SWITCH(TO_NATIVE_CASE)
+	default:
+		break;
+	}
+}
+
+#define TRY_GET_CASE(_tag, _type)                                        \
+	case NativeType::_tag:                                               \
+		return ValueConverter<_type>::TryGet(dataObject, *static_cast<_type*>(address)); \
+
+/// <summary>
+/// Writes value of dataObject in to native memory holding the type described by type without boxing it,
+/// returns false if dataObject holds a different type
+/// </summary>
+inline bool ToNative(NativeType type, System::Configuration::DataObject^ dataObject, void* address)
+{
+	switch (type)
+	{
+		NATIVE_TYPE_SWITCH(TRY_GET_CASE)
+	default:
+		return false;
+	}
+}
+
+/// <summary>
+/// Reads native memory holding the type described by type as a managed value
+/// </summary>
+inline System::Object^ ToManaged(NativeType type, const void* address)
+{
+	switch (type)
+	{
+		NATIVE_TYPE_SWITCH(TO_MANAGED_CASE)
+	default:
+		return nullptr;
+	}
+}
+
+/// <summary>
+/// Managed type a DataObject holds for the type described by type
+/// </summary>
+inline System::Type^ ManagedTypeOf(NativeType type)
+{
+	switch (type)
+	{
+	case NativeType::String: return System::String::typeid;
+	case NativeType::Bool: return System::Boolean::typeid;
+	case NativeType::UInt16: return System::UInt16::typeid;
+	case NativeType::UInt32: return System::UInt32::typeid;
+	case NativeType::UInt64: return System::UInt64::typeid;
+	case NativeType::Int16: return System::Int16::typeid;
+	case NativeType::Int32: return System::Int32::typeid;
+	case NativeType::Int64: return System::Int64::typeid;
+	case NativeType::Float: return System::Single::typeid;
+	case NativeType::Double: return System::Double::typeid;
+	case NativeType::DateTime: return System::DateTime::typeid;
+	case NativeType::TimeSpan: return System::TimeSpan::typeid;
+	case NativeType::Point: return System::Configuration::Point::typeid;
+	case NativeType::Color: return System::Configuration::Color::typeid;
+	default: return nullptr;
+	}
+}
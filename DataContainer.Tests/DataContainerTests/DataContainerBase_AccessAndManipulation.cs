@@ -8,6 +8,7 @@ using DataContainer.Utils;
 using System.Configuration;
 using System.Configuration.Validation;
 using System.Linq;
+using System.Threading.Tasks;
 
 namespace DataContainer.Tests
 {
@@ -487,5 +488,298 @@ namespace DataContainer.Tests
             Assert.Equal(2, keys.Count);
             Assert.DoesNotContain("B.BB.BB1", keys);
         }
+
+        [Fact]
+        public async Task DataContainerBase_Store_MustDeserializeAsync()
+        {
+            string path = Path.GetTempFileName();
+
+            IDataContainer dc = DataContainerBuilder.Create("AsyncTest")
+                .Data("A", 1)
+                .Data("B", "Hello")
+                .Build();
+
+            Assert.True(await ((DataContainerBase)dc).SaveAsXmlAsync(path));
+
+            IDataContainer loaded = await System.Configuration.DataContainer.FromXmlFileAsync(path);
+
+            File.Delete(path);
+
+            Assert.NotNull(loaded);
+            Assert.Equal(path, loaded.FilePath);
+            Assert.Equal(1, loaded.GetValue<int>("A"));
+            Assert.Equal("Hello", loaded.GetValue<string>("B"));
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustLoadDirectory()
+        {
+            string directory = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            Directory.CreateDirectory(directory);
+
+            DataContainerBuilder.Create("First").Data("A", 1).Build().SaveAsXml(Path.Combine(directory, "First.xml"));
+            DataContainerBuilder.Create("Second").Data("A", 2).Build().SaveAsXml(Path.Combine(directory, "2nd file.xml"));
+            File.WriteAllText(Path.Combine(directory, "Broken.xml"), "<DataContainer>");
+
+            IDataContainer loaded = System.Configuration.DataContainer.FromDirectory(directory, "*.xml", out IDictionary<string, string> errors);
+
+            Directory.Delete(directory, true);
+
+            Assert.Equal(2, loaded.Count);
+            Assert.Equal(1, loaded.GetValue<int>("First.A"));
+            Assert.Equal(2, loaded.GetValue<int>("_2nd_file.A"));
+            Assert.Single(errors);
+            Assert.Contains(Path.Combine(directory, "Broken.xml"), errors.Keys);
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustDeserializeCompressedBinary()
+        {
+            string path = Path.GetTempFileName();
+
+            IDataContainer dc = DataContainerBuilder.Create("Compressed")
+                .Data("A", 1)
+                .Data("B", "Hello")
+                .Data("C", 1.5)
+                .Data("D", new DateTime(2020, 1, 2, 3, 4, 5, DateTimeKind.Utc))
+                .Data("E", DataContainerBuilder.Create("E")
+                    .Data("A", 2)
+                    .Build())
+                .Data("F", new Point(1, 2))
+                .Build();
+
+            Assert.True(((DataContainerBase)dc).SaveAsCompressedBinary(path));
+
+            IDataContainer loaded = System.Configuration.DataContainer.FromCompressedBinaryFile(path);
+            IDataContainer partial = System.Configuration.DataContainer.FromCompressedBinaryFile(path, "E");
+
+            File.Delete(path);
+
+            Assert.Equal("Compressed", loaded.Name);
+            Assert.Equal(1, loaded.GetValue<int>("A"));
+            Assert.Equal("Hello", loaded.GetValue<string>("B"));
+            Assert.Equal(1.5, loaded.GetValue<double>("C"));
+            Assert.Equal(new DateTime(2020, 1, 2, 3, 4, 5, DateTimeKind.Utc), loaded.GetValue<DateTime>("D"));
+            Assert.Equal(2, loaded.GetValue<int>("E.A"));
+            Assert.Equal(2, loaded.GetValue<Point>("F").Y);
+
+            Assert.Equal(1, partial.Count);
+            Assert.Equal(2, partial.GetValue<int>("E.A"));
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustDeserializeJson()
+        {
+            string path = Path.GetTempFileName();
+
+            IDataContainer dc = DataContainerBuilder.Create("Json")
+                .Data("A", 1)
+                .Data("B", "Hello")
+                .Data("C", 2.0)
+                .Data("D", new DateTime(2020, 1, 2, 3, 4, 5, DateTimeKind.Utc))
+                .Data("E", DataContainerBuilder.Create("E")
+                    .Data("A", 2L)
+                    .Build())
+                .Data("F", new Point(1, 2))
+                .Data("G", new[] { 1.5f, 2.5f })
+                .Build();
+
+            Assert.True(((DataContainerBase)dc).SaveAsJson(path));
+
+            IDataContainer loaded = System.Configuration.DataContainer.FromJsonFile(path);
+
+            File.Delete(path);
+
+            Assert.Equal("Json", loaded.Name);
+            Assert.Equal(1, loaded.GetValue<int>("A"));
+            Assert.Equal("Hello", loaded.GetValue<string>("B"));
+            Assert.Equal(2.0, loaded.GetValue<double>("C"));
+            Assert.Equal(new DateTime(2020, 1, 2, 3, 4, 5, DateTimeKind.Utc), loaded.GetValue<DateTime>("D"));
+            Assert.Equal(2L, loaded.GetValue<long>("E.A"));
+            Assert.Equal(2, loaded.GetValue<Point>("F").Y);
+            Assert.Equal(new[] { 1.5f, 2.5f }, loaded.GetValue<float[]>("G"));
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustReadBlobsOnDemand()
+        {
+            string path = Path.GetTempFileName();
+            byte[] data = new byte[200 * 1024];
+            new Random(1).NextBytes(data);
+
+            var dc = (DataContainerBase)DataContainerBuilder.Create("Blobs")
+                .Data("A", 1)
+                .Data("Calibration", new Blob(data))
+                .Build();
+
+            Assert.True(dc.SaveAsCompressedBinary(path));
+
+            IDataContainer loaded = System.Configuration.DataContainer.FromCompressedBinaryFile(path);
+            Blob blob = loaded.GetValue<Blob>("Calibration");
+
+            Assert.False(blob.IsLoaded);
+            Assert.Equal(data.Length, blob.Length);
+
+            byte[] chunk = new byte[16];
+            Assert.Equal(16, blob.Read(100000, chunk, 0, chunk.Length));
+            Assert.Equal(data.Skip(100000).Take(16), chunk);
+
+            // saving over the file blob is read from keeps it readable
+            Assert.True(((DataContainerBase)loaded).SaveAsCompressedBinary(path));
+            Assert.Equal(data, blob.ToArray());
+
+            blob.Write(data.Length, chunk, 0, chunk.Length);
+
+            File.Delete(path);
+
+            Assert.True(blob.IsLoaded);
+            Assert.Equal(data.Length + chunk.Length, blob.Length);
+            Assert.Equal(1, loaded.GetValue<int>("A"));
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustSerializeBlobAsXml()
+        {
+            string path = Path.GetTempFileName();
+            byte[] data = new byte[100 * 1024];
+            new Random(2).NextBytes(data);
+
+            DataContainerBuilder.Create("Blobs")
+                .Data("Calibration", new Blob(data))
+                .Build()
+                .SaveAsXml(path);
+
+            IDataContainer loaded = System.Configuration.DataContainer.FromXmlFile(path);
+
+            File.Delete(path);
+
+            Assert.Equal(data, loaded.GetValue<Blob>("Calibration").ToArray());
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustLoadFromXmlCache()
+        {
+            string path = Path.GetTempFileName();
+            string cachePath = XmlCacheHelper.GetCachePath(path);
+
+            DataContainerBuilder.Create("Cached").Data("A", 1).Build().SaveAsXml(path);
+
+            IDataContainer first = System.Configuration.DataContainer.FromXmlFile(path, true);
+
+            Assert.True(File.Exists(cachePath));
+
+            IDataContainer cached = System.Configuration.DataContainer.FromXmlFile(path, true);
+
+            DataContainerBuilder.Create("Cached").Data("A", 2).Build().SaveAsXml(path);
+
+            IDataContainer changed = System.Configuration.DataContainer.FromXmlFile(path, true);
+
+            File.Delete(path);
+            File.Delete(cachePath);
+
+            Assert.Equal(1, first.GetValue<int>("A"));
+            Assert.Equal(1, cached.GetValue<int>("A"));
+            Assert.Equal(path, cached.FilePath);
+            Assert.Equal(2, changed.GetValue<int>("A"));
+        }
+
+        [Fact]
+        public void DataContainerBase_Store_MustKeepBlobsLoadedFromXmlCache()
+        {
+            string path = Path.GetTempFileName();
+            string cachePath = XmlCacheHelper.GetCachePath(path);
+            byte[] data = new byte[100 * 1024];
+            new Random(3).NextBytes(data);
+
+            DataContainerBuilder.Create("Cached").Data("Calibration", new Blob(data)).Build().SaveAsXml(path);
+
+            System.Configuration.DataContainer.FromXmlFile(path, true);
+            IDataContainer cached = System.Configuration.DataContainer.FromXmlFile(path, true);
+            Blob blob = cached.GetValue<Blob>("Calibration");
+
+            // rewrites the cache file
+            DataContainerBuilder.Create("Cached").Data("Calibration", new Blob(new byte[10])).Build().SaveAsXml(path);
+            IDataContainer changed = System.Configuration.DataContainer.FromXmlFile(path, true);
+
+            File.Delete(path);
+            File.Delete(cachePath);
+
+            Assert.Equal(data, blob.ToArray());
+            Assert.Equal(10, changed.GetValue<Blob>("Calibration").Length);
+        }
+
+        [Fact]
+        public void PropertyContainerBase_Store_MustLoadValuesOnly()
+        {
+            string path = Path.GetTempFileName();
+
+            IPropertyContainer dc = PropertyContainerBuilder.Create("Properties")
+                .Property("A", 5, p => p
+                    .SetValidation(ValidationBuilder.Create().Range(1, 100))
+                    .SetCategory("Cat")
+                    .SetDescription("Desc")
+                    .SetDisplayName("Display"))
+                .Property("B", "Hello")
+                .Build();
+
+            (dc.Find("A") as PropertyObject).SetBrowsePermission(BrowseOptions.NonEditable);
+            dc.SaveAsXml(path);
+
+            IPropertyContainer all = PropertyContainerBuilder.FromXmlFile(path);
+            IPropertyContainer valuesOnly = PropertyContainerBuilder.FromXmlFile(path, PropertyLoadOptions.ValuesOnly);
+
+            File.Delete(path);
+
+            var full = all.Find("A") as PropertyObject;
+            var values = valuesOnly.Find("A") as PropertyObject;
+
+            Assert.Equal("Cat", full.Category);
+            Assert.Equal("Desc", full.Description);
+            Assert.Equal("Display", full.DisplayName);
+            Assert.Equal(BrowseOptions.NonEditable, full.BrowseOption);
+            Assert.IsType<RangeValidator>(full.Validation.Rules[0]);
+
+            Assert.Equal(5, values.GetValue());
+            Assert.Equal("Hello", valuesOnly.GetValue<string>("B"));
+            Assert.Null(values.Category);
+            Assert.Null(values.Description);
+            Assert.Null(values.Validation);
+            Assert.Equal("A", values.DisplayName);
+            Assert.Equal(BrowseOptions.Browsable, values.BrowseOption);
+        }
+
+        [Fact]
+        public void PropertyContainerBase_Store_MustReportInvalidValidations()
+        {
+            string path = Path.GetTempFileName();
+
+            PropertyContainerBuilder.Create("Properties")
+                .Property("A", 5, p => p.SetValidation(ValidationBuilder.Create().Range(1, 100)))
+                .Build()
+                .SaveAsXml(path);
+
+            File.WriteAllText(path, File.ReadAllText(path).Replace("Cascade=\"false\"", "Cascade=\"maybe\""));
+
+            IPropertyContainer loaded = PropertyContainerBuilder.FromXmlFile(path);
+
+            File.Delete(path);
+
+            var errors = new List<string>();
+            DataContainerEvents.OnEventDelegate onEvent = (type, message) => errors.Add(type);
+            DataContainerEvents.OnEvent += onEvent;
+
+            try
+            {
+                var obj = loaded.Find("A") as PropertyObject;
+
+                Assert.Null(obj.Validation);
+                Assert.True(obj.SetValue(50));
+                Assert.Contains("Error", errors);
+            }
+            finally
+            {
+                DataContainerEvents.OnEvent -= onEvent;
+            }
+        }
     }
 }
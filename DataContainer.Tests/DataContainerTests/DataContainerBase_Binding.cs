@@ -142,5 +142,38 @@ namespace DataContainer.Tests
             Assert.NotEqual(32, propertyValue);
             Assert.Equal(NEW_VALUE, propertyValue);
         }
+    
+
+        [Fact]
+        public void DataContainerBase_RemoveBinding_MustAllowRebinding()
+        {
+            const string PROP_NAME = "IntProperty";
+            const int VALUE = 42;
+            const int NEW_VALUE = 14;
+
+            DataContainerBase property = (DataContainerBase)PropertyContainerBuilder.Create()
+                .Property(PROP_NAME, VALUE)
+                .Build();
+
+            var bindingTarget = new BindingTestObject();
+            var otherTarget = new BindingTestObject();
+
+            property.SetBinding(PROP_NAME, () => bindingTarget.IntProperty, BindingMode.OneWay);
+            property.SetBinding(PROP_NAME, () => otherTarget.IntProperty, BindingMode.OneWay);
+
+            property.RemoveBinding(PROP_NAME, () => bindingTarget.IntProperty);
+
+            property.SetValue(PROP_NAME, NEW_VALUE);
+
+            Assert.Equal(VALUE, bindingTarget.IntProperty);
+            Assert.Equal(NEW_VALUE, otherTarget.IntProperty);
+
+            property.SetBinding(PROP_NAME, () => bindingTarget.IntProperty, BindingMode.OneWay);
+
+            Assert.Equal(NEW_VALUE, bindingTarget.IntProperty);
+
+            property.RemoveBinding(PROP_NAME, () => bindingTarget.IntProperty);
+            property.RemoveBinding(PROP_NAME, () => otherTarget.IntProperty);
+        }
     }
 }
@@ -191,5 +191,25 @@ namespace DataContainer.Tests
             Assert.Single(listener.PropertiesChanged);
 
         }
+
+        [Fact]
+        public void IDataContainer_ShouldRaisePropertyChangedWhenNestedContainerReplaced()
+        {
+            IDataContainer A = DataContainerBuilder.Create("A")
+                .DataContainer("AA", b => b
+                    .Data("A1", 23))
+                .Build();
+
+            IDataContainer replacement = DataContainerBuilder.Create("AA")
+                .Data("A1", 42)
+                .Build();
+
+            var listener = new PropertyChangedListener(A);
+
+            Assert.True(A.SetValue("AA", replacement));
+
+            Assert.Equal("AA", listener.LastChangedProperty);
+            Assert.Equal(42, A.GetValue<int>("AA.A1"));
+        }
     }
 }
@@ -223,5 +223,97 @@ namespace DataContainer.Tests
 
             Assert.DoesNotContain("DisplayName", xml);
         }
+
+        [Fact]
+        public void IValueObject_ShouldReadAndWriteTypedValue()
+        {
+            DataObject data = DataObjectFactory.GetDataObjectFor("A", 22);
+            DataObject property = DataObjectFactory.GetPropertyObjectFor("B", new Point(1, 2));
+
+            var typedData = Assert.IsAssignableFrom<IValueObject<int>>(data);
+            var typedProperty = Assert.IsAssignableFrom<IValueObject<Point>>(property);
+
+            Assert.Equal(22, typedData.Value);
+            Assert.True(typedData.SetValue(30));
+            Assert.Equal(30, data.GetValue());
+
+            Assert.True(typedProperty.SetValue(new Point(3, 4)));
+            Assert.Equal(new Point(3, 4), property.GetValue());
+            Assert.False(property is IValueObject<int>);
+        }
+
+        [Fact]
+        public void IValueObject_SetValueShouldValidate()
+        {
+            DataObject orig = new IntPropertyObject("A", 22);
+
+            INumericPropertyObject numeric = (INumericPropertyObject)orig;
+            numeric.Max = 50;
+            numeric.Min = 10;
+
+            var typed = (IValueObject<int>)orig;
+
+            Assert.False(typed.SetValue(60));
+            Assert.Equal(22, typed.Value);
+            Assert.True(typed.SetValue(40));
+            Assert.Equal(40, typed.Value);
+        }
+
+        [Fact]
+        public void IValueObject_SetValueShouldReportRejectedValue()
+        {
+            var typed = (IValueObject<int>)new EvenDataObject("A", 2);
+
+            Assert.False(typed.SetValue(3));
+            Assert.Equal(2, typed.Value);
+            Assert.True(typed.SetValue(4));
+            Assert.Equal(4, typed.Value);
+        }
+
+        private class EvenDataObject : DataObject<int>
+        {
+            public override string Type => DataObjectType.Integer;
+
+            public EvenDataObject(string name, int value)
+            {
+                Name = name;
+                Value = value;
+            }
+
+            protected override bool Validate(int value) => value % 2 == 0;
+        }
+
+        [Fact]
+        public void IValueObject_SetValueShouldNotAllocate()
+        {
+            IDataContainer dc = DataContainerBuilder.Create()
+                .Data("A", 1)
+                .Build();
+
+            var data = (IValueObject<int>)dc.Find("A");
+            var property = (IValueObject<double>)DataObjectFactory.GetPropertyObjectFor("B", 1.0);
+
+            void Set(int count)
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    data.SetValue(i);
+                    data.SetValue(i);
+                    property.SetValue(i);
+                }
+            }
+
+            // warm up so nothing is allocated by the first call
+            Set(100);
+
+            long before = GC.GetAllocatedBytesForCurrentThread();
+
+            Set(10000);
+
+            Assert.Equal(0, GC.GetAllocatedBytesForCurrentThread() - before);
+
+            // string value is still available when asked for
+            Assert.Equal("9999", ((DataObject)data).StringValue);
+        }
     }
 }
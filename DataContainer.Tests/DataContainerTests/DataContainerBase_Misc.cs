@@ -138,6 +138,138 @@ namespace DataContainer.Tests
 
         #endregion
 
+        #region History
+
+        [Fact]
+        public void History_UndoAndRedoRestoreValues()
+        {
+            IDataContainer A = (DataContainerBase)DataContainerBuilder.Create("A")
+                .Data("A", 1)
+                .DataContainer("AB", b => b
+                    .Data("AB1", "x"))
+                .Build();
+
+            DataContainerHistory history = A.GetHistory();
+
+            A["A"] = 2;
+            A["AB.AB1"] = "y";
+
+            Assert.Equal(2, history.Version);
+            Assert.Equal("AB.AB1", history.Entries.Last().Items.Single().Key);
+            Assert.Equal("x", history.Entries.Last().Items.Single().OldValue);
+
+            Assert.True(history.Undo());
+            Assert.Equal("x", A["AB.AB1"]);
+            Assert.True(history.Undo());
+            Assert.Equal(1, A["A"]);
+            Assert.False(history.Undo());
+
+            Assert.True(history.Redo());
+            Assert.Equal(2, A["A"]);
+            Assert.Equal(1, history.Version);
+
+            // new change drops what was undone
+            A["A"] = 5;
+            Assert.False(history.CanRedo);
+            Assert.Equal(2, history.LatestVersion);
+        }
+
+        [Fact]
+        public void History_TransactionIsUndoneAsOneEntry()
+        {
+            IDataContainer A = (DataContainerBase)DataContainerBuilder.Create("A")
+                .Data("A", 1)
+                .Data("B", 2)
+                .Build();
+
+            DataContainerHistory history = A.GetHistory();
+
+            using (history.BeginTransaction())
+            {
+                A["A"] = 10;
+                A["B"] = 20;
+                A["A"] = 11;
+            }
+
+            Assert.Single(history.Entries);
+            Assert.Equal(3, history.Entries.Single().Items.Count);
+
+            history.Undo();
+
+            Assert.Equal(1, A["A"]);
+            Assert.Equal(2, A["B"]);
+        }
+
+        [Fact]
+        public void History_RestoreToVersionWithinCapacity()
+        {
+            IDataContainer A = (DataContainerBase)DataContainerBuilder.Create("A")
+                .Data("A", 0)
+                .Build();
+
+            DataContainerHistory history = A.GetHistory(3);
+
+            for (int i = 1; i <= 5; i++)
+            {
+                A["A"] = i;
+            }
+
+            Assert.Equal(3, history.Entries.Count());
+            Assert.Equal(2, history.OldestVersion);
+            Assert.False(history.RestoreTo(1));
+
+            Assert.True(history.RestoreTo(2));
+            Assert.Equal(2, A["A"]);
+
+            Assert.True(history.RestoreTo(4));
+            Assert.Equal(4, A["A"]);
+        }
+
+        [Fact]
+        public void History_ShouldFollowAddedContainers()
+        {
+            IDataContainer A = (DataContainerBase)DataContainerBuilder.Create("A")
+                .Data("A", 1)
+                .Build();
+
+            DataContainerHistory history = A.GetHistory();
+
+            IDataContainer B = (DataContainerBase)DataContainerBuilder.Create("B")
+                .Data("B1", 1.5)
+                .Build();
+
+            A.PutValue("B", B);
+            A["B.B1"] = 2.5;
+
+            Assert.Equal("B.B1", history.Entries.Single().Items.Single().Key);
+
+            history.Dispose();
+            A["B.B1"] = 3.5;
+
+            Assert.Single(history.Entries);
+        }
+
+        [Fact]
+        public void History_ShouldNotRecordUnchangedValues()
+        {
+            IDataContainer A = (DataContainerBase)DataContainerBuilder.Create("A")
+                .Data("A", 1.0)
+                .Build();
+
+            DataContainerHistory history = A.GetHistory();
+
+            A["A"] = 2.0;
+
+            // same value in another format
+            A.Find("A").StringValue = "2.00";
+            A["A"] = 2.0;
+
+            Assert.Single(history.Entries);
+            Assert.Equal(2.0, A["A"]);
+        }
+
+        #endregion
+
         #region Cloning
 
         [Fact]
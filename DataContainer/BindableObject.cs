@@ -13,6 +13,11 @@ namespace System.Configuration
             PropertyChanged?.Invoke(this, new PropertyChangedEventArgs(property));
         }
 
+        public void RaisePropertyChanged(PropertyChangedEventArgs args)
+        {
+            PropertyChanged?.Invoke(this, args);
+        }
+
         public bool SetProperty<T>(ref T storage, T value, [CallerMemberName] string property = "")
         {
             if (EqualityComparer<T>.Default.Equals(storage, value) == true)
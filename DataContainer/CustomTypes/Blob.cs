@@ -0,0 +1,400 @@
+﻿using System.IO;
+using System.Runtime.Serialization;
+using System.Xml;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Large binary value which is read and written in chunks instead of being copied as a whole.
+    ///
+    /// A blob is either held in memory or refers to a range of a file, blobs loaded from files written by
+    /// <see cref="CompressedBinaryHelper"/> are not read until <see cref="Read(long, byte[], int, int)"/> is called.
+    /// Writing in to a blob that refers to a file loads it in to memory first.
+    /// </summary>
+    [Serializable]
+    public sealed class Blob : ISerializable
+    {
+        /// <summary>
+        /// Size of chunks used when copying blob to and from streams
+        /// </summary>
+        internal const int ChunkSize = 64 * 1024;
+
+        private readonly object _sync = new object();
+
+        /// <summary>
+        /// Content when held in memory, only first <see cref="_length"/> bytes are used
+        /// </summary>
+        private byte[] _data;
+        private long _length;
+
+        /// <summary>
+        /// File and range holding the content when it is not in memory
+        /// </summary>
+        private string _path;
+        private long _offset;
+        private DateTime _lastWriteTime;
+
+        /// <summary>
+        /// Creates empty blob
+        /// </summary>
+        public Blob() : this(Array.Empty<byte>()) { }
+
+        /// <summary>
+        /// Creates blob holding <paramref name="data"/>, the array is used without copying it
+        /// </summary>
+        /// <param name="data"></param>
+        public Blob(byte[] data)
+        {
+            _data = data ?? throw new ArgumentNullException(nameof(data));
+            _length = data.Length;
+        }
+
+        /// <summary>
+        /// Creates blob referring to <paramref name="length"/> bytes of file <paramref name="path"/> starting at <paramref name="offset"/>
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="offset"></param>
+        /// <param name="length"></param>
+        internal Blob(string path, long offset, long length)
+        {
+            Attach(path, offset, length);
+        }
+
+        /// <summary>
+        /// Constructor for binary deserialization
+        /// </summary>
+        /// <param name="info"></param>
+        /// <param name="context"></param>
+        private Blob(SerializationInfo info, StreamingContext context) : this((byte[])info.GetValue("Data", typeof(byte[]))) { }
+
+        /// <summary>
+        /// Creates blob referring to file at <paramref name="path"/>, file is read on demand
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static Blob FromFile(string path)
+        {
+            var info = new FileInfo(path);
+
+            return new Blob(info.FullName, 0, info.Length);
+        }
+
+        /// <summary>
+        /// Number of bytes in blob
+        /// </summary>
+        public long Length
+        {
+            get
+            {
+                lock (_sync)
+                {
+                    return _length;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Is content held in memory, false if it is still read from a file
+        /// </summary>
+        public bool IsLoaded
+        {
+            get
+            {
+                lock (_sync)
+                {
+                    return _path is null;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Full path of the file content is read from, null if it's held in memory
+        /// </summary>
+        internal string SourcePath
+        {
+            get
+            {
+                lock (_sync)
+                {
+                    return _path;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Copies up to <paramref name="count"/> bytes starting at <paramref name="position"/> in to <paramref name="buffer"/>
+        /// </summary>
+        /// <param name="position">position in blob to start reading from</param>
+        /// <param name="buffer">buffer to copy in to</param>
+        /// <param name="offset">offset in <paramref name="buffer"/> to copy to</param>
+        /// <param name="count">maximum number of bytes to copy</param>
+        /// <returns>number of bytes copied, 0 if <paramref name="position"/> is at or past the end</returns>
+        public int Read(long position, byte[] buffer, int offset, int count)
+        {
+            CheckArguments(position, buffer, offset, count);
+
+            lock (_sync)
+            {
+                if (position >= _length)
+                {
+                    return 0;
+                }
+
+                count = (int)Math.Min(count, _length - position);
+
+                if (_path is null)
+                {
+                    Buffer.BlockCopy(_data, (int)position, buffer, offset, count);
+
+                    return count;
+                }
+
+                using (var stream = OpenSource())
+                {
+                    ReadSource(stream, position, buffer, offset, count);
+                }
+
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Writes <paramref name="count"/> bytes of <paramref name="buffer"/> at <paramref name="position"/>,
+        /// blob grows if needed and any gap is filled with zeros.
+        /// </summary>
+        /// <param name="position">position in blob to start writing at</param>
+        /// <param name="buffer">buffer to copy from</param>
+        /// <param name="offset">offset in <paramref name="buffer"/> to copy from</param>
+        /// <param name="count">number of bytes to copy</param>
+        public void Write(long position, byte[] buffer, int offset, int count)
+        {
+            CheckArguments(position, buffer, offset, count);
+
+            lock (_sync)
+            {
+                Load();
+
+                long end = position + count;
+
+                if (end > int.MaxValue)
+                {
+                    throw new ArgumentOutOfRangeException(nameof(count), "Blob held in memory can't exceed 2 GB");
+                }
+
+                if (end > _data.Length)
+                {
+                    var data = new byte[Math.Max(end, Math.Min((long)_data.Length * 2, int.MaxValue))];
+                    Buffer.BlockCopy(_data, 0, data, 0, (int)_length);
+                    _data = data;
+                }
+                else if (position > _length)
+                {
+                    Array.Clear(_data, (int)_length, (int)(position - _length));
+                }
+
+                Buffer.BlockCopy(buffer, offset, _data, (int)position, count);
+                _length = Math.Max(_length, end);
+            }
+        }
+
+        /// <summary>
+        /// Copies content in to a new array
+        /// </summary>
+        /// <returns></returns>
+        public byte[] ToArray()
+        {
+            lock (_sync)
+            {
+                if (_path is null)
+                {
+                    var copy = new byte[_length];
+                    Buffer.BlockCopy(_data, 0, copy, 0, copy.Length);
+
+                    return copy;
+                }
+
+                return ReadAll();
+            }
+        }
+
+        /// <summary>
+        /// Copies content to <paramref name="stream"/> in chunks
+        /// </summary>
+        /// <param name="stream"></param>
+        internal void CopyTo(Stream stream)
+        {
+            lock (_sync)
+            {
+                if (_path is null)
+                {
+                    stream.Write(_data, 0, (int)_length);
+                    return;
+                }
+
+                ReadChunks((buffer, count) => stream.Write(buffer, 0, count));
+            }
+        }
+
+        /// <summary>
+        /// Makes blob refer to a range of file, used after content was written there
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="offset"></param>
+        /// <param name="length"></param>
+        internal void Attach(string path, long offset, long length)
+        {
+            lock (_sync)
+            {
+                _path = Path.GetFullPath(path);
+                _offset = offset;
+                _length = length;
+                _lastWriteTime = File.GetLastWriteTimeUtc(_path);
+                _data = null;
+            }
+        }
+
+        /// <summary>
+        /// Writes content as base64 in chunks
+        /// </summary>
+        /// <param name="writer"></param>
+        internal void WriteXml(XmlWriter writer)
+        {
+            lock (_sync)
+            {
+                if (_path is null)
+                {
+                    writer.WriteBase64(_data, 0, (int)_length);
+                    return;
+                }
+
+                ReadChunks((buffer, count) => writer.WriteBase64(buffer, 0, count));
+            }
+        }
+
+        /// <summary>
+        /// Reads base64 content of the element <paramref name="reader"/> is on in chunks
+        /// </summary>
+        /// <param name="reader"></param>
+        /// <returns></returns>
+        internal static Blob ReadXml(XmlReader reader)
+        {
+            var blob = new Blob();
+            var buffer = new byte[ChunkSize];
+            int count;
+
+            while ((count = reader.ReadElementContentAsBase64(buffer, 0, buffer.Length)) > 0)
+            {
+                blob.Write(blob._length, buffer, 0, count);
+            }
+
+            return blob;
+        }
+
+        /// <summary>
+        /// Implementation for <see cref="ISerializable.GetObjectData(SerializationInfo, StreamingContext)"/>
+        /// </summary>
+        /// <param name="info"></param>
+        /// <param name="context"></param>
+        public void GetObjectData(SerializationInfo info, StreamingContext context)
+        {
+            info.AddValue("Data", ToArray());
+        }
+
+        /// <summary>
+        /// Loads content from file in to memory
+        /// </summary>
+        private void Load()
+        {
+            if (_path is null)
+            {
+                return;
+            }
+
+            _data = ReadAll();
+            _path = null;
+        }
+
+        private byte[] ReadAll()
+        {
+            if (_length > int.MaxValue)
+            {
+                throw new InvalidOperationException("Blob held in memory can't exceed 2 GB");
+            }
+
+            var data = new byte[_length];
+
+            using (var stream = OpenSource())
+            {
+                ReadSource(stream, 0, data, 0, data.Length);
+            }
+
+            return data;
+        }
+
+        /// <summary>
+        /// Reads content from file in chunks of <see cref="ChunkSize"/>, passing each to <paramref name="chunk"/>
+        /// </summary>
+        /// <param name="chunk"></param>
+        private void ReadChunks(Action<byte[], int> chunk)
+        {
+            var buffer = new byte[(int)Math.Min(ChunkSize, _length)];
+
+            using (var stream = OpenSource())
+            {
+                for (long position = 0; position < _length; position += buffer.Length)
+                {
+                    int count = (int)Math.Min(buffer.Length, _length - position);
+
+                    ReadSource(stream, position, buffer, 0, count);
+                    chunk(buffer, count);
+                }
+            }
+        }
+
+        private void ReadSource(FileStream stream, long position, byte[] buffer, int offset, int count)
+        {
+            stream.Position = _offset + position;
+
+            while (count > 0)
+            {
+                int read = stream.Read(buffer, offset, count);
+
+                if (read == 0)
+                {
+                    throw new EndOfStreamException($"Blob content in \"{_path}\" is truncated");
+                }
+
+                offset += read;
+                count -= read;
+            }
+        }
+
+        private FileStream OpenSource()
+        {
+            if (File.GetLastWriteTimeUtc(_path) != _lastWriteTime)
+            {
+                throw new InvalidOperationException($"Blob content in \"{_path}\" was modified after it was loaded");
+            }
+
+            return new FileStream(_path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete);
+        }
+
+        private static void CheckArguments(long position, byte[] buffer, int offset, int count)
+        {
+            if (buffer is null)
+            {
+                throw new ArgumentNullException(nameof(buffer));
+            }
+
+            if (position < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(position));
+            }
+
+            if (offset < 0 || count < 0 || buffer.Length - offset < count)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count));
+            }
+        }
+    }
+}
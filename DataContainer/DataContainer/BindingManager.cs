@@ -1,5 +1,6 @@
 ﻿using System.Collections.Generic;
 using System.Linq;
+using System.Runtime.CompilerServices;
 using System.Timers;
 
 namespace System.Configuration
@@ -19,7 +20,11 @@ namespace System.Configuration
             }
         }
 
-        private List<DataObjectBinding> _bindings = new List<DataObjectBinding>();
+        /// <summary>
+        /// Bindings indexed by (target, property name), so that registering, finding
+        /// and removing a binding does not have to scan every binding in the application.
+        /// </summary>
+        private readonly Dictionary<BindingKey, DataObjectBinding> _bindings = new Dictionary<BindingKey, DataObjectBinding>();
         private readonly Timer timer = new Timer(TimeSpan.FromHours(1).TotalMilliseconds);
 
         internal BindingManager()
@@ -37,7 +42,7 @@ namespace System.Configuration
             if (_bindings.Count == 0)
                 return;
 
-            var expiredBindings = _bindings.Where(x => x.BindingTarget.IsAlive == false);
+            var expiredBindings = _bindings.Values.Where(x => x.BindingTarget.IsAlive == false).ToList();
 
             foreach (var binding in expiredBindings)
             {
@@ -45,14 +50,56 @@ namespace System.Configuration
             }
         }
 
-        internal void AddBinding(DataObjectBinding pb) => _bindings.Add(pb);
+        internal void AddBinding(DataObjectBinding pb) => _bindings[pb.Key] = pb;
 
-        internal DataObjectBinding GetBinding(object target, string name) => _bindings.Find(x => x.BindingTarget == target && x.TargetProperty.Name == name);
+        internal DataObjectBinding GetBinding(object target, string name)
+            => _bindings.TryGetValue(new BindingKey(target, name), out DataObjectBinding pb) ? pb : null;
 
         internal void RemoveBinding(DataObjectBinding pb)
         {
+            _bindings.Remove(pb.Key);
             pb.Dispose();
-            _bindings.Remove(pb);
         }
     }
+
+    /// <summary>
+    /// Key used to index <see cref="DataObjectBinding"/> inside <see cref="BindingManager"/>
+    /// Compares binding targets by reference and only holds a weak reference to them,
+    /// so indexing a binding will not keep its target alive.
+    /// </summary>
+    internal sealed class BindingKey : IEquatable<BindingKey>
+    {
+        private readonly WeakReference target;
+        private readonly int targetHash;
+        private readonly string propertyName;
+
+        public BindingKey(object target, string propertyName)
+        {
+            this.target = new WeakReference(target);
+            this.propertyName = propertyName;
+            targetHash = RuntimeHelpers.GetHashCode(target);
+        }
+
+        public bool Equals(BindingKey other)
+        {
+            if (other is null)
+            {
+                return false;
+            }
+
+            if (ReferenceEquals(this, other))
+            {
+                return true;
+            }
+
+            return targetHash == other.targetHash &&
+                propertyName == other.propertyName &&
+                target.Target is object t &&
+                ReferenceEquals(t, other.target.Target);
+        }
+
+        public override bool Equals(object obj) => Equals(obj as BindingKey);
+
+        public override int GetHashCode() => (targetHash * 397) ^ (propertyName?.GetHashCode() ?? 0);
+    }
 }
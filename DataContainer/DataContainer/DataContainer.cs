@@ -1,4 +1,5 @@
-﻿using System.Collections.Generic;
+﻿using System.Collections.Concurrent;
+using System.Collections.Generic;
 using System.Collections.Specialized;
 using System.Configuration.Utils;
 using System.IO;
@@ -6,6 +7,7 @@ using System.Linq;
 using System.Reflection;
 using System.Runtime.Serialization;
 using System.Runtime.Serialization.Formatters.Binary;
+using System.Threading.Tasks;
 using System.Xml.Serialization;
 
 namespace System.Configuration
@@ -149,6 +151,147 @@ namespace System.Configuration
             return null;
         }
 
+        /// <summary>
+        /// Create <see cref="DataContainer"/> from XML serialized file
+        /// </summary>
+        /// <param name="path">Path to XML file</param>
+        /// <param name="useCache">Load from and keep a pre-parsed cache file next to the XML file, see <see cref="XmlCacheHelper"/></param>
+        /// <returns><see cref="DataContainer"/> deserilized from path</returns>
+        public static IDataContainer FromXmlFile(string path, bool useCache)
+        {
+            if (useCache == false)
+            {
+                return FromXmlFile(path);
+            }
+
+            if (XmlCacheHelper.DeserializeFromFile(path) is DataContainerBase dc)
+            {
+                dc.FilePath = path;
+                return dc;
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Create <see cref="DataContainer"/> from XML serialized file without blocking on file I/O
+        /// </summary>
+        /// <param name="path">Path to XML file</param>
+        /// <returns><see cref="DataContainer"/> deserilized from path</returns>
+        public static async Task<IDataContainer> FromXmlFileAsync(string path)
+        {
+            if (await XmlHelper.DeserializeFromFileAsync(path, typeof(DataContainer)).ConfigureAwait(false) is DataContainer dc)
+            {
+                dc.FilePath = path;
+                return dc;
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Create <see cref="DataContainer"/> holding one child container per XML file in <paramref name="path"/>
+        /// Files are deserialized in parallel, children are keyed by file name, made into a valid identifier if needed.
+        /// </summary>
+        /// <param name="path">Directory to load from</param>
+        /// <param name="searchPattern">Search pattern for files in directory</param>
+        /// <param name="errors">Error message for each file that could not be loaded, keyed by file path</param>
+        /// <returns><see cref="DataContainer"/> with loaded files</returns>
+        public static IDataContainer FromDirectory(string path, string searchPattern, out IDictionary<string, string> errors)
+        {
+            var root = new DataContainer { Name = Path.GetFileName(path), FilePath = path };
+            var failed = new ConcurrentDictionary<string, string>();
+
+            string[] files;
+
+            try
+            {
+                files = Directory.GetFiles(path, searchPattern);
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError($"Error reading directory :{path}, {ex}");
+
+                failed[path] = ex.Message;
+                errors = failed;
+                return root;
+            }
+
+            Array.Sort(files, StringComparer.Ordinal);
+
+            var loaded = new DataContainer[files.Length];
+            var serializer = XmlHelper.GetSerializer(typeof(DataContainer));
+
+            Parallel.For(0, files.Length, i =>
+            {
+                try
+                {
+                    using (var stream = new FileStream(files[i], FileMode.Open, FileAccess.Read, FileShare.Read))
+                    {
+                        var dc = (DataContainer)serializer.Deserialize(stream);
+                        dc.FilePath = files[i];
+                        loaded[i] = dc;
+                    }
+                }
+                catch (Exception ex)
+                {
+                    failed[files[i]] = ex.InnerException?.Message ?? ex.Message;
+                }
+            });
+
+            for (int i = 0; i < files.Length; i++)
+            {
+                if (loaded[i] is DataContainer dc)
+                {
+                    string key = Path.GetFileNameWithoutExtension(files[i]).ToValidIdentifier();
+
+                    if (root.internalDictionary.ContainsKey(key))
+                    {
+                        failed[files[i]] = $"Duplicate key \"{key}\"";
+                        continue;
+                    }
+
+                    dc.Name = key;
+                    root.Add(new ContainerDataObject(key, dc));
+                }
+            }
+
+            errors = failed;
+            return root;
+        }
+
+        /// <summary>
+        /// Create <see cref="DataContainer"/> from compressed binary file, see <see cref="CompressedBinaryHelper"/>
+        /// </summary>
+        /// <param name="path">Path to compressed binary file</param>
+        /// <param name="keys">Top level keys to load, everything is loaded if none are given</param>
+        /// <returns>Deserialized container, null if reading failed</returns>
+        public static IDataContainer FromCompressedBinaryFile(string path, params string[] keys)
+        {
+            if (CompressedBinaryHelper.DeserializeFromFile(path, keys) is DataContainerBase dc)
+            {
+                dc.FilePath = path;
+                return dc;
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Create <see cref="DataContainer"/> from JSON file, see <see cref="JsonHelper"/>
+        /// </summary>
+        /// <param name="path">Path to JSON file</param>
+        /// <returns>Deserialized container, null if reading failed</returns>
+        public static IDataContainer FromJsonFile(string path)
+        {
+            if (JsonHelper.DeserializeFromFile(path) is DataContainerBase dc)
+            {
+                dc.FilePath = path;
+                return dc;
+            }
+
+            return null;
+        }
 
         public static IDataContainer FromBinaryFile(string path)
         {
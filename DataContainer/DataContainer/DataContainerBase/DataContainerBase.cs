@@ -9,6 +9,7 @@ using System.Linq.Expressions;
 using System.Reflection;
 using System.Runtime.CompilerServices;
 using System.Runtime.Serialization;
+using System.Threading.Tasks;
 using System.Xml.Serialization;
 
 namespace System.Configuration
@@ -181,6 +182,18 @@ namespace System.Configuration
         /// <returns></returns>
         public bool SaveAsXml() => SaveAsXml(FilePath);
 
+        /// <summary>
+        /// Serializes DataContainer object to an XML file to the given path without blocking on file I/O
+        /// </summary>
+        /// <param name="path">file path to store the config</param>
+        /// <returns>Is Sucess</returns>
+        public Task<bool> SaveAsXmlAsync(string path)
+        {
+            FilePath = path;
+
+            return XmlHelper.SerializeToFileAsync(this, path);
+        }
+
         /// <summary>
         /// Serializer object to a binary file in given path
         /// </summary>
@@ -208,6 +221,20 @@ namespace System.Configuration
         /// </summary>
         public bool SaveAsBinary() => SaveAsBinary(FilePath);
 
+        /// <summary>
+        /// Serializes object to a compressed binary file in given path, see <see cref="CompressedBinaryHelper"/>
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public bool SaveAsCompressedBinary(string path) => CompressedBinaryHelper.SerializeToFile(this, path);
+
+        /// <summary>
+        /// Serializes object to a JSON file in given path, see <see cref="JsonHelper"/>
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public bool SaveAsJson(string path) => JsonHelper.SerializeToFile(this, path);
+
         /// <summary>
         /// Checks if the Object contains data with given key
         /// </summary>
@@ -32,6 +32,11 @@ namespace System.Configuration
         /// </summary>
         public BindingMode Mode { get; set; }
 
+        /// <summary>
+        /// Key used by <see cref="BindingManager"/> to index this binding
+        /// </summary>
+        public BindingKey Key { get; }
+
         /// <summary>
         /// Constructor
         /// </summary>
@@ -42,6 +47,7 @@ namespace System.Configuration
         public DataObjectBinding(object target, DataObject property, PropertyInfo targetProperty, BindingMode mode)
         {
             BindingTarget = new WeakReference(target);
+            Key = new BindingKey(target, targetProperty.Name);
             Property = property;
             TargetProperty = targetProperty;
             Mode = mode;
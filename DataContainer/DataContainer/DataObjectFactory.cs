@@ -33,6 +33,7 @@ namespace System.Configuration
         public const string Xml = "xml";
         public const string Json = "json";
         public const string Password = "pwd";
+        public const string Blob = "blob";
         public const string NotSupported = "404";
     }
 
@@ -70,7 +71,8 @@ namespace System.Configuration
             { DataObjectType.Point , typeof(PointDataObject)},
             { DataObjectType.Xml , typeof(XmlDataObject) },
             { DataObjectType.Json , typeof(JsonDataObject) },
-            { DataObjectType.Password , typeof(PasswordDataObject) }
+            { DataObjectType.Password , typeof(PasswordDataObject) },
+            { DataObjectType.Blob , typeof(BlobDataObject) }
         };
 
         /// <summary>
@@ -93,7 +95,8 @@ namespace System.Configuration
             { typeof(Color), typeof(ColorDataObject) },
             { typeof(DateTime), typeof(DateTimeDataObject)},
             { typeof(TimeSpan), typeof(TimeSpanDataObject)},
-            { typeof(Point), typeof(PointDataObject)}
+            { typeof(Point), typeof(PointDataObject)},
+            { typeof(Blob), typeof(BlobDataObject)}
         };
 
         /// <summary>
@@ -129,6 +132,7 @@ namespace System.Configuration
             { DataObjectType.Xml , typeof(XmlPropertyObject) },
             { DataObjectType.Json , typeof(JsonPropertyObject) },
             { DataObjectType.Password, typeof(PasswordPropertyObject) },
+            { DataObjectType.Blob, typeof(BlobPropertyObject) },
         };
 
 
@@ -152,7 +156,8 @@ namespace System.Configuration
             { typeof(Color), typeof(ColorPropertyObject)},
             { typeof(DateTime), typeof(DateTimePropertyObject) },
             { typeof(TimeSpan), typeof(TimeSpanPropertyObject)},
-            { typeof(Point), typeof(PointPropertyObject)}
+            { typeof(Point), typeof(PointPropertyObject)},
+            { typeof(Blob), typeof(BlobPropertyObject)}
         };
 
         /// <summary>
@@ -195,6 +200,17 @@ namespace System.Configuration
                 : new NotSupportedDataObject();
         }
 
+        /// <summary>
+        /// Checks whether <paramref name="obj"/> is the registered <see cref="DataObject"/> implementation for its <see cref="DataObject.Type"/>,
+        /// so it can be recreated from its value alone.
+        /// </summary>
+        /// <param name="obj"></param>
+        /// <returns></returns>
+        internal static bool IsDefaultDataObject(DataObject obj)
+        {
+            return typeIdDataObjMapping.TryGetValue(obj.Type, out Type type) && type == obj.GetType();
+        }
+
         /// <summary>
         /// Gets an initialized <see cref="DataObject"/> instance of type <paramref name="type"/>
         /// with name <paramref name="name"/> and value <paramref name="value"/>
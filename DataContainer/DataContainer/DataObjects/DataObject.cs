@@ -13,6 +13,26 @@ namespace System.Configuration
         void WriteBytes(BinaryWriter writer);
     }
 
+    /// <summary>
+    /// Typed access to value of <see cref="DataObject{T}"/> and <see cref="PropertyObject{T}"/>,
+    /// lets callers that know the type read and write it without boxing.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    public interface IValueObject<T>
+    {
+        /// <summary>
+        /// Value held by object
+        /// </summary>
+        T Value { get; }
+
+        /// <summary>
+        /// Same as <see cref="DataObject.SetValue(object)"/> for a value that is already of type <typeparamref name="T"/>
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        bool SetValue(T value);
+    }
+
     /// <summary>
     /// Abstraction for holding different type of data in <see cref="IDataContainer"/>
     /// Handles Xml Serialization and Deserialization
@@ -52,6 +72,12 @@ namespace System.Configuration
             protected set { name = value; }
         }
 
+        /// <summary>
+        /// Shared by every object so changing a value doesn't allocate event args
+        /// </summary>
+        protected static readonly PropertyChangedEventArgs ValueChangedEventArgs = new PropertyChangedEventArgs("Value");
+        protected static readonly PropertyChangedEventArgs StringValueChangedEventArgs = new PropertyChangedEventArgs(nameof(StringValue));
+
         /// <summary>
         /// Value as string if possible
         /// </summary>
@@ -71,6 +97,21 @@ namespace System.Configuration
         /// </summary>
         public abstract string Type { get; }
 
+        /// <summary>
+        /// Raised after value changed with the value it replaced, used by <see cref="DataContainerHistory"/>
+        /// </summary>
+        internal event Action<DataObject, object> ValueReplaced;
+
+        /// <summary>
+        /// Raises <see cref="ValueReplaced"/>, <paramref name="oldValue"/> is only boxed if someone is listening
+        /// </summary>
+        /// <typeparam name="TValue"></typeparam>
+        /// <param name="oldValue"></param>
+        protected void RaiseValueReplaced<TValue>(TValue oldValue)
+        {
+            ValueReplaced?.Invoke(this, oldValue);
+        }
+
         /// <summary>
         /// Writes <see cref="StringValue"/> as <see cref="VALUE_ATTRIBUTE"/> in xml if returns true
         /// </summary>
@@ -282,7 +323,7 @@ namespace System.Configuration
     /// Generic implementation for DataObject for primitive types.
     /// </summary>
     /// <typeparam name="T"></typeparam>
-    public abstract class DataObject<T> : DataObject
+    public abstract class DataObject<T> : DataObject, IValueObject<T>
     {
         /// <summary>
         /// Default contructor
@@ -307,18 +348,34 @@ namespace System.Configuration
             get { return _value; }
             set
             {
-                // update string value whenever our value changes
-                stringValue = ConvertToString(value);
+                // string value is formatted again the next time it's read
+                stringValue = null;
 
                 if (EqualityComparer<T>.Default.Equals(_value, value) == true)
                 {
                     return;
                 }
 
+                T oldValue = _value;
                 _value = value;
 
-                RaisePropertyChanged(nameof(Value));
-                RaisePropertyChanged(nameof(StringValue));
+                RaisePropertyChanged(ValueChangedEventArgs);
+                RaisePropertyChanged(StringValueChangedEventArgs);
+                RaiseValueReplaced(oldValue);
+            }
+        }
+
+        /// <summary>
+        /// Formatted from <see cref="Value"/> when it's read, so setting values doesn't allocate strings nobody reads
+        /// </summary>
+        public override string StringValue
+        {
+            get { return stringValue ?? (stringValue = ConvertToString(_value)); }
+            set
+            {
+                // compare against the formatted value so an unchanged string doesn't raise changed
+                stringValue = StringValue;
+                base.StringValue = value;
             }
         }
 
@@ -394,6 +451,23 @@ namespace System.Configuration
             return false;
         }
 
+        /// <summary>
+        /// Implementation for <see cref="IValueObject{T}.SetValue(T)"/>
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        bool IValueObject<T>.SetValue(T value)
+        {
+            bool isValid = Validate(value);
+
+            if (isValid)
+            {
+                Value = value;
+            }
+
+            return isValid;
+        }
+
         /// <summary>
         /// Return type of value held by object
         /// </summary>
@@ -423,8 +497,15 @@ namespace System.Configuration
                 if (ConvertFromString(value) is T newValue
                     && Validate(newValue))
                 {
+                    T oldValue = _value;
                     _value = newValue;
-                    RaisePropertyChanged(nameof(Value));
+
+                    // string may differ only in format, e.g. "1.0" and "1"
+                    if (EqualityComparer<T>.Default.Equals(oldValue, newValue) == false)
+                    {
+                        RaisePropertyChanged(ValueChangedEventArgs);
+                        RaiseValueReplaced(oldValue);
+                    }
                 }
             }
         }
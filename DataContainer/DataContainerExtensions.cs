@@ -443,6 +443,16 @@ namespace System.Configuration
         /// <returns></returns>
         public static DataContainerAutoUpdater GetAutoUpdater(this IDataContainer dc) => new DataContainerAutoUpdater(dc);
 
+        /// <summary>
+        /// Get instance of <see cref="DataContainerHistory"/> recording changes from now on.
+        /// Always returns new instance.
+        /// </summary>
+        /// <param name="dc"></param>
+        /// <param name="capacity">Maximum number of entries kept</param>
+        /// <returns></returns>
+        public static DataContainerHistory GetHistory(this IDataContainer dc, int capacity = DataContainerHistory.DEFAULT_CAPACITY)
+            => new DataContainerHistory(dc, capacity);
+
         /// <summary>
         /// Gets the current values in the datacontainer
         /// </summary>
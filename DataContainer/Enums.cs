@@ -21,6 +21,22 @@
         NonEditable
     }
 
+    /// <summary>
+    /// What is read when loading an <see cref="IPropertyContainer"/>
+    /// </summary>
+    public enum PropertyLoadOptions
+    {
+        /// <summary>
+        /// Values and the metadata used by property editors.
+        /// </summary>
+        All,
+
+        /// <summary>
+        /// Only values, Description, Category, DisplayName, browse option and validations are skipped.
+        /// </summary>
+        ValuesOnly
+    }
+
     public enum BindingMode
     {
         /// <summary>
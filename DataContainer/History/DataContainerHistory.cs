@@ -0,0 +1,425 @@
+﻿using System.Collections.Generic;
+using System.Collections.Specialized;
+using System.ComponentModel;
+using System.Linq;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Records changes to values of a <see cref="IDataContainer"/> and its nested containers,
+    /// so they can be undone, redone or rolled back to an earlier version.
+    ///
+    /// Only the old and new value of each change is kept, in a ring buffer holding the latest <see cref="Capacity"/> entries,
+    /// so memory depends on the number of changes and not on the size of the container.
+    /// Adding and removing values is not recorded.
+    /// </summary>
+    public class DataContainerHistory : IDisposable
+    {
+        public const int DEFAULT_CAPACITY = 100;
+
+        private readonly IDataContainer _container;
+        private readonly HistoryEntry[] _entries;
+        private readonly Dictionary<IDataContainer, ContainerListener> _listeners = new Dictionary<IDataContainer, ContainerListener>();
+
+        // _entries[_head] is the oldest entry, the first _applied of _count entries are applied
+        private int _head;
+        private int _count;
+        private int _applied;
+        private long _baseVersion;
+
+        private int _transactionDepth;
+        private List<HistoryItem> _pending = new List<HistoryItem>();
+        private bool _applying;
+
+        /// <summary>
+        /// Maximum number of entries kept, oldest ones are dropped when it's full
+        /// </summary>
+        public int Capacity => _entries.Length;
+
+        /// <summary>
+        /// Version of the current values, incremented by every recorded change or transaction and by <see cref="Redo"/>,
+        /// decremented by <see cref="Undo"/>
+        /// </summary>
+        public long Version => _baseVersion + _applied;
+
+        /// <summary>
+        /// Oldest version that can still be restored
+        /// </summary>
+        public long OldestVersion => _baseVersion;
+
+        /// <summary>
+        /// Newest version that can be restored, higher than <see cref="Version"/> after an undo
+        /// </summary>
+        public long LatestVersion => _baseVersion + _count;
+
+        public bool CanUndo => _applied > 0 && _transactionDepth == 0;
+
+        public bool CanRedo => _applied < _count && _transactionDepth == 0;
+
+        /// <summary>
+        /// Entries from oldest to newest, including undone ones that can be redone
+        /// </summary>
+        public IEnumerable<HistoryEntry> Entries
+        {
+            get
+            {
+                for (int i = 0; i < _count; i++)
+                {
+                    yield return _entries[(_head + i) % Capacity];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="dc"></param>
+        /// <param name="capacity">Maximum number of entries kept</param>
+        public DataContainerHistory(IDataContainer dc, int capacity = DEFAULT_CAPACITY)
+        {
+            if (capacity <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(capacity));
+            }
+
+            _container = dc;
+            _entries = new HistoryEntry[capacity];
+
+            Attach(dc, string.Empty);
+        }
+
+        /// <summary>
+        /// Groups all changes made until returned object is disposed in to one entry.
+        /// Transactions can be nested, changes are recorded when the outermost one is disposed.
+        /// </summary>
+        /// <returns></returns>
+        public IDisposable BeginTransaction()
+        {
+            _transactionDepth++;
+
+            return new Transaction(this);
+        }
+
+        /// <summary>
+        /// Restores values changed by the latest applied entry
+        /// </summary>
+        /// <returns>false if there is nothing to undo</returns>
+        public bool Undo()
+        {
+            if (CanUndo == false)
+            {
+                return false;
+            }
+
+            HistoryEntry entry = _entries[(_head + _applied - 1) % Capacity];
+
+            Apply(entry.Items.Reverse(), undo: true);
+            _applied--;
+
+            return true;
+        }
+
+        /// <summary>
+        /// Applies the latest undone entry again
+        /// </summary>
+        /// <returns>false if there is nothing to redo</returns>
+        public bool Redo()
+        {
+            if (CanRedo == false)
+            {
+                return false;
+            }
+
+            HistoryEntry entry = _entries[(_head + _applied) % Capacity];
+
+            Apply(entry.Items, undo: false);
+            _applied++;
+
+            return true;
+        }
+
+        /// <summary>
+        /// Undoes or redoes entries until <see cref="Version"/> is <paramref name="version"/>
+        /// </summary>
+        /// <param name="version"></param>
+        /// <returns>false if version is no longer, or not yet, in history</returns>
+        public bool RestoreTo(long version)
+        {
+            if (version < OldestVersion || version > LatestVersion || _transactionDepth > 0)
+            {
+                return false;
+            }
+
+            while (Version > version)
+            {
+                Undo();
+            }
+
+            while (Version < version)
+            {
+                Redo();
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Removes all entries, current values are kept
+        /// </summary>
+        public void Clear()
+        {
+            Array.Clear(_entries, 0, Capacity);
+            _baseVersion = Version;
+            _head = 0;
+            _count = 0;
+            _applied = 0;
+        }
+
+        /// <summary>
+        /// Stops recording changes
+        /// </summary>
+        public void Dispose()
+        {
+            foreach (var listener in _listeners.Values.ToList())
+            {
+                listener.Detach();
+            }
+
+            _listeners.Clear();
+        }
+
+        private void Apply(IEnumerable<HistoryItem> items, bool undo)
+        {
+            _applying = true;
+
+            try
+            {
+                foreach (var item in items)
+                {
+                    _container.FindRecursive(item.Key)?.SetValue(undo ? item.OldValue : item.NewValue);
+                }
+            }
+            finally
+            {
+                _applying = false;
+            }
+        }
+
+        private void Record(string key, object oldValue, object newValue)
+        {
+            // nothing to undo, would only push real changes out of the buffer
+            if (_applying || Equals(oldValue, newValue))
+            {
+                return;
+            }
+
+            var item = new HistoryItem(key, oldValue, newValue, DateTime.Now);
+
+            if (_transactionDepth > 0)
+            {
+                _pending.Add(item);
+            }
+            else
+            {
+                Push(new[] { item });
+            }
+        }
+
+        private void EndTransaction()
+        {
+            _transactionDepth--;
+
+            if (_transactionDepth == 0 && _pending.Count > 0)
+            {
+                Push(_pending);
+                _pending = new List<HistoryItem>();
+            }
+        }
+
+        /// <summary>
+        /// Adds entry after the applied ones, dropping undone entries and the oldest one if full
+        /// </summary>
+        /// <param name="items"></param>
+        private void Push(IReadOnlyList<HistoryItem> items)
+        {
+            _count = _applied;
+
+            if (_count == Capacity)
+            {
+                _entries[_head] = null;
+                _head = (_head + 1) % Capacity;
+                _count--;
+                _applied--;
+                _baseVersion++;
+            }
+
+            _entries[(_head + _count) % Capacity] = new HistoryEntry(Version + 1, items);
+            _count++;
+            _applied++;
+        }
+
+        private void Attach(IDataContainer container, string path)
+        {
+            if (_listeners.ContainsKey(container) == false)
+            {
+                _listeners.Add(container, new ContainerListener(this, container, path));
+            }
+        }
+
+        private void Detach(IDataContainer container)
+        {
+            if (_listeners.TryGetValue(container, out ContainerListener listener))
+            {
+                _listeners.Remove(container);
+                listener.Detach();
+            }
+        }
+
+        /// <summary>
+        /// Listens to values of one container, and attaches to its nested containers
+        /// </summary>
+        private class ContainerListener
+        {
+            private readonly DataContainerHistory _history;
+            private readonly IDataContainer _container;
+            private readonly string _path;
+
+            // items listened to, and containers they hold
+            private readonly Dictionary<DataObject, IDataContainer> _items = new Dictionary<DataObject, IDataContainer>();
+
+            public ContainerListener(DataContainerHistory history, IDataContainer container, string path)
+            {
+                _history = history;
+                _container = container;
+                _path = path;
+
+                _container.CollectionChanged += OnCollectionChanged;
+
+                foreach (DataObject item in container)
+                {
+                    Add(item);
+                }
+            }
+
+            public void Detach()
+            {
+                _container.CollectionChanged -= OnCollectionChanged;
+
+                foreach (var item in _items.Keys.ToList())
+                {
+                    Remove(item);
+                }
+            }
+
+            private string GetKey(DataObject item) => string.IsNullOrEmpty(_path) ? item.Name : $"{_path}.{item.Name}";
+
+            private void Add(DataObject item)
+            {
+                if (_items.ContainsKey(item))
+                {
+                    return;
+                }
+
+                item.ValueReplaced += OnValueReplaced;
+
+                var child = item.GetValue() as IDataContainer;
+                _items.Add(item, child);
+
+                if (child != null)
+                {
+                    item.PropertyChanged += OnContainerReplaced;
+                    _history.Attach(child, GetKey(item));
+                }
+            }
+
+            private void Remove(DataObject item)
+            {
+                if (_items.TryGetValue(item, out IDataContainer child) == false)
+                {
+                    return;
+                }
+
+                item.ValueReplaced -= OnValueReplaced;
+                _items.Remove(item);
+
+                if (child != null)
+                {
+                    item.PropertyChanged -= OnContainerReplaced;
+                    _history.Detach(child);
+                }
+            }
+
+            private void OnValueReplaced(DataObject item, object oldValue)
+            {
+                _history.Record(GetKey(item), oldValue, item.GetValue());
+            }
+
+            /// <summary>
+            /// Follows nested containers being replaced
+            /// </summary>
+            private void OnContainerReplaced(object sender, PropertyChangedEventArgs e)
+            {
+                if (e.PropertyName == "Value" && sender is DataObject item
+                    && _items.TryGetValue(item, out IDataContainer child)
+                    && ReferenceEquals(child, item.GetValue()) == false)
+                {
+                    Remove(item);
+                    Add(item);
+                }
+            }
+
+            private void OnCollectionChanged(object sender, NotifyCollectionChangedEventArgs e)
+            {
+                if (e.Action == NotifyCollectionChangedAction.Reset)
+                {
+                    foreach (var item in _items.Keys.ToList())
+                    {
+                        Remove(item);
+                    }
+
+                    foreach (DataObject item in _container)
+                    {
+                        Add(item);
+                    }
+
+                    return;
+                }
+
+                if (e.OldItems != null)
+                {
+                    foreach (DataObject item in e.OldItems)
+                    {
+                        Remove(item);
+                    }
+                }
+
+                if (e.NewItems != null)
+                {
+                    foreach (DataObject item in e.NewItems)
+                    {
+                        Add(item);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Ends transaction when disposed
+        /// </summary>
+        private class Transaction : IDisposable
+        {
+            private DataContainerHistory _history;
+
+            public Transaction(DataContainerHistory history)
+            {
+                _history = history;
+            }
+
+            public void Dispose()
+            {
+                _history?.EndTransaction();
+                _history = null;
+            }
+        }
+    }
+}
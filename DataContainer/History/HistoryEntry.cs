@@ -0,0 +1,27 @@
+﻿using System.Collections.Generic;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Changes undone and redone together by <see cref="DataContainerHistory"/>,
+    /// either a single change or all changes made in a transaction.
+    /// </summary>
+    public class HistoryEntry
+    {
+        /// <summary>
+        /// <see cref="DataContainerHistory.Version"/> after the changes were made
+        /// </summary>
+        public long Version { get; }
+
+        /// <summary>
+        /// Changes in the order they were made
+        /// </summary>
+        public IReadOnlyList<HistoryItem> Items { get; }
+
+        public HistoryEntry(long version, IReadOnlyList<HistoryItem> items)
+        {
+            Version = version;
+            Items = items;
+        }
+    }
+}
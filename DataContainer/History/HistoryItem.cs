@@ -0,0 +1,30 @@
+﻿namespace System.Configuration
+{
+    /// <summary>
+    /// A single value change recorded by <see cref="DataContainerHistory"/>
+    /// </summary>
+    public class HistoryItem
+    {
+        /// <summary>
+        /// Full key of the value, nested keys are separated by '.'
+        /// </summary>
+        public string Key { get; }
+
+        public object OldValue { get; }
+
+        public object NewValue { get; }
+
+        /// <summary>
+        /// When the change was made
+        /// </summary>
+        public DateTime Timestamp { get; }
+
+        public HistoryItem(string key, object oldValue, object newValue, DateTime timestamp)
+        {
+            Key = key;
+            OldValue = oldValue;
+            NewValue = newValue;
+            Timestamp = timestamp;
+        }
+    }
+}
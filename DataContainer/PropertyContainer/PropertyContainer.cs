@@ -89,6 +89,26 @@ namespace System.Configuration
             return null;
         }
 
+        /// <summary>
+        /// Load state from xml file.
+        /// With <see cref="PropertyLoadOptions.ValuesOnly"/> editor metadata is not read, for services that only need values.
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="options"></param>
+        /// <returns></returns>
+        public static IPropertyContainer FromXmlFile(string path, PropertyLoadOptions options)
+        {
+            if (options == PropertyLoadOptions.All)
+            {
+                return FromXmlFile(path);
+            }
+
+            using (PropertyObject.ReadValuesOnly())
+            {
+                return FromXmlFile(path);
+            }
+        }
+
         /// <summary>
         /// Load state from binary file
         /// </summary>
@@ -60,6 +60,15 @@ namespace System.Configuration
         /// <returns></returns>
         public static IPropertyContainer FromXmlFile(string path) => Configuration.PropertyContainer.FromXmlFile(path);
 
+        /// <summary>
+        /// Create <see cref="IPropertyContainer"/> from xml file, reading only what <paramref name="options"/> asks for
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="options"></param>
+        /// <returns></returns>
+        public static IPropertyContainer FromXmlFile(string path, PropertyLoadOptions options)
+            => Configuration.PropertyContainer.FromXmlFile(path, options);
+
         /// <summary>
         /// Create <see cref="IPropertyContainer"/> from binary file
         /// </summary>
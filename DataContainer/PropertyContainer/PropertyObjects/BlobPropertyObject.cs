@@ -0,0 +1,92 @@
+﻿using System.Runtime.Serialization;
+using System.Xml;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// PropertyObject implementation for <see cref="Blob"/>, content is written to XML as base64 in a Value element
+    /// </summary>
+    [Serializable]
+    internal class BlobPropertyObject : PropertyObject<Blob>
+    {
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="name"></param>
+        /// <param name="value"></param>
+        public BlobPropertyObject(string name, Blob value)
+        {
+            Name = name;
+            Value = value;
+        }
+
+        /// <summary>
+        /// Constructor for binary deserialization
+        /// </summary>
+        /// <param name="info"></param>
+        /// <param name="context"></param>
+        public BlobPropertyObject(SerializationInfo info, StreamingContext context) : base(info, context) { }
+
+        /// <summary>
+        /// Implementation for <see cref="DataObject.Type"/>
+        /// </summary>
+        public override string Type => DataObjectType.Blob;
+
+        /// <summary>
+        /// Only the length is shown as string, content is never converted as a whole
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        public override string ConvertToString(Blob value)
+        {
+            return value is null ? null : $"{value.Length} bytes";
+        }
+
+        /// <summary>
+        /// Implementation for <see cref="DataObject.CanConvertFromString(string)"/>
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        public override bool CanConvertFromString(string value) => false;
+
+        /// <summary>
+        /// Implementation for <see cref="DataObject.CanWriteValueAsXmlAttribute"/>
+        /// </summary>
+        /// <returns></returns>
+        protected override bool CanWriteValueAsXmlAttribute() { return false; }
+
+        /// <summary>
+        /// Implementation for <see cref="DataObject.WriteXmlContent(XmlWriter)"/>
+        /// </summary>
+        /// <param name="writer"></param>
+        protected override void WriteXmlContent(XmlWriter writer)
+        {
+            base.WriteXmlContent(writer);
+
+            if (Value != null)
+            {
+                writer.WriteStartElement(nameof(Value));
+                Value.WriteXml(writer);
+                writer.WriteEndElement();
+            }
+        }
+
+        /// <summary>
+        /// Implementation for <see cref="DataObject.ReadXmlElement(string, XmlReader)"/>
+        /// </summary>
+        /// <param name="elementName"></param>
+        /// <param name="reader"></param>
+        /// <returns></returns>
+        protected override bool ReadXmlElement(string elementName, XmlReader reader)
+        {
+            if (elementName == nameof(Value))
+            {
+                Value = Blob.ReadXml(reader);
+
+                return true;
+            }
+
+            return base.ReadXmlElement(elementName, reader);
+        }
+    }
+}
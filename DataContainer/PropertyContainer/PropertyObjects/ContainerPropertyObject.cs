@@ -115,7 +115,13 @@ namespace System.Configuration
         {
             if (value is IDataContainer dc)
             {
-                _container = dc;
+                if (ReferenceEquals(_container, dc) == false)
+                {
+                    _container = dc;
+
+                    // let listeners holding on to the previous container know it was replaced
+                    RaisePropertyChanged(nameof(Value));
+                }
             }
             else if (Value.GetType() != value.GetType())
             {
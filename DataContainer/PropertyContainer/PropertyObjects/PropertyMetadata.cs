@@ -0,0 +1,30 @@
+﻿using System.Configuration.Validation;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Editor metadata of a <see cref="PropertyObject"/>.
+    /// Kept apart from the value and only allocated when any of it differs from the default,
+    /// so containers that are only read for their values don't pay for it.
+    /// </summary>
+    internal sealed class PropertyMetadata
+    {
+        public string Description { get; set; }
+
+        public string Category { get; set; }
+
+        /// <summary>
+        /// null when same as Name
+        /// </summary>
+        public string DisplayName { get; set; }
+
+        public BrowseOptions BrowseOption { get; set; } = BrowseOptions.Browsable;
+
+        public ValidatorGroup Validation { get; set; }
+
+        /// <summary>
+        /// Xml of <see cref="Validation"/> as read from file, parsed the first time validation is asked for
+        /// </summary>
+        public string ValidationXml { get; set; }
+    }
+}
@@ -1,6 +1,7 @@
 ﻿using System.Collections.Generic;
 using System.ComponentModel;
 using System.Configuration.Validation;
+using System.IO;
 using System.Runtime.Serialization;
 using System.Xml;
 
@@ -17,11 +18,24 @@ namespace System.Configuration
         // xml strings
         public const string BROWSE_ATTRIBUTE = "browse";
         public const string CATEGORY_ATTRIBUTE = "category";
+        private const string VALIDATIONS_ELEMENT = "Validations";
+
+        /// <summary>
+        /// Set while loading with <see cref="PropertyLoadOptions.ValuesOnly"/>.
+        /// Objects are created and read by the xml serializer, so there is no other way to pass the option down to them.
+        /// </summary>
+        [ThreadStatic]
+        private static bool valuesOnly;
+
+        /// <summary>
+        /// Only used by property editors, null until any of it is set.
+        /// </summary>
+        private PropertyMetadata metadata;
 
         #region Properties
 
         /// <summary>
-        /// Set display name as Name initiallly
+        /// Display name follows Name unless it's set explicitly
         /// </summary>
         public override string Name
         {
@@ -29,24 +43,60 @@ namespace System.Configuration
             protected set
             {
                 base.Name = value;
-                DisplayName = value;
+
+                if (metadata != null)
+                {
+                    metadata.DisplayName = null;
+                }
             }
         }
 
         /// <summary>
         /// A Description of what the Data would be used for.
         /// </summary>
-        public string Description { get; set; }
+        public string Description
+        {
+            get { return metadata?.Description; }
+            set
+            {
+                if (value != null || metadata != null)
+                {
+                    GetMetadata().Description = value;
+                }
+            }
+        }
 
         /// <summary>
         /// Category of Data when displayed in a property grid
         /// </summary>
-        public string Category { get; set; }
+        public string Category
+        {
+            get { return metadata?.Category; }
+            set
+            {
+                if (value != null || metadata != null)
+                {
+                    GetMetadata().Category = value;
+                }
+            }
+        }
 
         /// <summary>
         /// Name shown in property grid
         /// </summary>
-        public string DisplayName { get; set; }
+        public string DisplayName
+        {
+            get { return metadata?.DisplayName ?? Name; }
+            set
+            {
+                string displayName = value == Name ? null : value;
+
+                if (displayName != null || metadata != null)
+                {
+                    GetMetadata().DisplayName = displayName;
+                }
+            }
+        }
 
         /// <summary>
         /// Property to indicate whether this Object stores
@@ -56,12 +106,40 @@ namespace System.Configuration
 
         /// <summary>
         /// Validations for this property
+        /// Validations read from xml are only deserialized the first time they are asked for.
         /// </summary>
-        private ValidatorGroup validation;
         public ValidatorGroup Validation
         {
-            get { return validation; }
-            set { SetProperty(ref validation, value); }
+            get
+            {
+                if (metadata?.ValidationXml is string xml)
+                {
+                    metadata.ValidationXml = null;
+
+                    // reported like any other error in the file it was read from
+                    try
+                    {
+                        metadata.Validation = XmlHelper.DeserializeFromString<ValidatorGroup>(xml);
+                    }
+                    catch (Exception ex)
+                    {
+                        DataContainerEvents.NotifyError($"Error reading validations of {Name}, {ex}");
+                    }
+                }
+
+                return metadata?.Validation;
+            }
+            set
+            {
+                if (Validation == value)
+                {
+                    return;
+                }
+
+                GetMetadata().Validation = value;
+
+                RaisePropertyChanged();
+            }
         }
 
         /// <summary>
@@ -69,7 +147,17 @@ namespace System.Configuration
         /// Used by Property Editors Hide Property or Disable editing
         /// </summary>
         [Browsable(false)]
-        public BrowseOptions BrowseOption { get; set; } = BrowseOptions.Browsable;
+        public BrowseOptions BrowseOption
+        {
+            get { return metadata?.BrowseOption ?? BrowseOptions.Browsable; }
+            set
+            {
+                if (value != BrowseOptions.Browsable || metadata != null)
+                {
+                    GetMetadata().BrowseOption = value;
+                }
+            }
+        }
 
         /// <summary>
         /// Force Ivoke RaisPropertyChanged() so that Validations will get exectued
@@ -79,6 +167,32 @@ namespace System.Configuration
 
         #endregion
 
+        private PropertyMetadata GetMetadata() => metadata ?? (metadata = new PropertyMetadata());
+
+        /// <summary>
+        /// Skips metadata of every <see cref="PropertyObject"/> read from xml on this thread till the result is disposed.
+        /// </summary>
+        /// <returns></returns>
+        internal static IDisposable ReadValuesOnly()
+        {
+            var scope = new ValuesOnlyScope(valuesOnly);
+            valuesOnly = true;
+
+            return scope;
+        }
+
+        private sealed class ValuesOnlyScope : IDisposable
+        {
+            private readonly bool previous;
+
+            public ValuesOnlyScope(bool previous)
+            {
+                this.previous = previous;
+            }
+
+            public void Dispose() => valuesOnly = previous;
+        }
+
         public PropertyObject() { }
 
         public PropertyObject(SerializationInfo info, StreamingContext context) : base(info, context)
@@ -132,8 +246,15 @@ namespace System.Configuration
                 writer.WriteElementString(nameof(Description), Description);
             }
 
-            // Write validation if we have one
-            if (Validation != null)
+            // Write validation if we have one, as it was read if nobody asked for it
+            if (metadata?.ValidationXml is string xml)
+            {
+                using (var reader = XmlReader.Create(new StringReader(xml)))
+                {
+                    writer.WriteNode(reader, true);
+                }
+            }
+            else if (Validation != null)
             {
                 writer.WriteObjectXml(Validation);
             }
@@ -149,6 +270,11 @@ namespace System.Configuration
             // do base implementation
             base.ReadXmlAttributes(reader);
 
+            if (valuesOnly)
+            {
+                return;
+            }
+
             // read browse option
             if (reader.GetAttribute(BROWSE_ATTRIBUTE) is string attr)
             {
@@ -174,6 +300,14 @@ namespace System.Configuration
         /// <returns></returns>
         protected override bool ReadXmlElement(string elementName, XmlReader reader)
         {
+            // Skip metadata when only values are wanted
+            if (valuesOnly && IsMetadataElement(elementName))
+            {
+                reader.Skip();
+
+                return true;
+            }
+
             // Read description
             if (elementName == nameof(Description))
             {
@@ -196,9 +330,11 @@ namespace System.Configuration
                 return true;
             }
             // Read Validations
-            else if (elementName == "Validations")
+            // Keep Validations as xml, most of them are never looked at
+            else if (elementName == VALIDATIONS_ELEMENT)
             {
-                Validation = reader.ReadObjectXml<ValidatorGroup>();
+                GetMetadata().Validation = null;
+                GetMetadata().ValidationXml = reader.ReadOuterXml();
 
                 return true;
             }
@@ -206,6 +342,14 @@ namespace System.Configuration
             return false;
         }
 
+        private static bool IsMetadataElement(string elementName)
+        {
+            return elementName == nameof(Description)
+                || elementName == nameof(DisplayName)
+                || elementName == nameof(Category)
+                || elementName == VALIDATIONS_ELEMENT;
+        }
+
         /// <summary>
         /// Helper fuction to set Description in <see cref="PropertyContainerBuilder"/>
         /// </summary>
@@ -272,7 +416,7 @@ namespace System.Configuration
     /// </summary>
     /// <typeparam name="T"></typeparam>
     [Serializable]
-    public abstract class PropertyObject<T> : PropertyObject
+    public abstract class PropertyObject<T> : PropertyObject, IValueObject<T>
     {
         public PropertyObject() { }
 
@@ -290,18 +434,34 @@ namespace System.Configuration
             get { return _value; }
             set
             {
-                // update string value whenever our value changes
-                stringValue = ConvertToString(value);
+                // string value is formatted again the next time it's read
+                stringValue = null;
 
                 if (EqualityComparer<T>.Default.Equals(_value, value) == true)
                 {
                     return;
                 }
 
+                T oldValue = _value;
                 _value = value;
 
-                RaisePropertyChanged(nameof(Value));
-                RaisePropertyChanged(nameof(StringValue));
+                RaisePropertyChanged(ValueChangedEventArgs);
+                RaisePropertyChanged(StringValueChangedEventArgs);
+                RaiseValueReplaced(oldValue);
+            }
+        }
+
+        /// <summary>
+        /// Formatted from <see cref="Value"/> when it's read, so setting values doesn't allocate strings nobody reads
+        /// </summary>
+        public override string StringValue
+        {
+            get { return stringValue ?? (stringValue = ConvertToString(_value)); }
+            set
+            {
+                // compare against the formatted value so an unchanged string doesn't raise changed
+                stringValue = StringValue;
+                base.StringValue = value;
             }
         }
 
@@ -381,6 +541,23 @@ namespace System.Configuration
             }
         }
 
+        /// <summary>
+        /// Implementation for <see cref="IValueObject{T}.SetValue(T)"/>
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        bool IValueObject<T>.SetValue(T value)
+        {
+            bool isValid = Validate(value);
+
+            if (isValid)
+            {
+                Value = value;
+            }
+
+            return isValid;
+        }
+
         /// <summary>
         /// Implementation for <see cref="DataObject.GetDataType"/>
         /// </summary>
@@ -413,8 +590,15 @@ namespace System.Configuration
                 if (ConvertFromString(value) is T newValue
                     && Validate(newValue))
                 {
+                    T oldValue = _value;
                     _value = newValue;
-                    RaisePropertyChanged(nameof(Value));
+
+                    // string may differ only in format, e.g. "1.0" and "1"
+                    if (EqualityComparer<T>.Default.Equals(oldValue, newValue) == false)
+                    {
+                        RaisePropertyChanged(ValueChangedEventArgs);
+                        RaiseValueReplaced(oldValue);
+                    }
                 }
             }
         }
@@ -0,0 +1,684 @@
+﻿using System.Collections.Generic;
+using System.IO;
+using System.IO.Compression;
+using System.Text;
+using System.Xml;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Reads and writes <see cref="IDataContainer"/> in a compact binary format.
+    ///
+    /// Key names and type ids are stored once in a per file dictionary and referenced by index,
+    /// top level <see cref="DataObject"/>s are grouped in to blocks which are compressed independently,
+    /// so a subset of keys can be loaded by decompressing only the blocks that hold them.
+    /// <see cref="Blob"/> values are stored uncompressed after the blocks and only referenced from them,
+    /// when reading from a file they are not read until they're accessed.
+    ///
+    /// Layout : header, dictionary, block table, blocks, blobs.
+    /// </summary>
+    public static class CompressedBinaryHelper
+    {
+        private static readonly byte[] Magic = Encoding.ASCII.GetBytes("DCZ");
+        private const byte Version = 2;
+
+        /// <summary>
+        /// Uncompressed size after which a new block is started
+        /// </summary>
+        private const int BlockSize = 64 * 1024;
+
+        private const byte DataContainerRoot = 0;
+        private const byte PropertyContainerRoot = 1;
+
+        private const byte ValueRecord = 0;
+        private const byte ContainerRecord = 1;
+        private const byte XmlRecord = 2;
+        private const byte BlobRecord = 3;
+
+        /// <summary>
+        /// Serializes <paramref name="container"/> to <paramref name="path"/>
+        /// </summary>
+        /// <param name="container">container to serialize</param>
+        /// <param name="path">file path to serialize to</param>
+        /// <returns>Is success</returns>
+        public static bool SerializeToFile(IDataContainer container, string path)
+        {
+            // blobs may still be read from the file being replaced, so write next to it first
+            string tempPath = path + ".tmp";
+
+            try
+            {
+                BlobSection blobs;
+
+                using (var stream = new FileStream(tempPath, FileMode.Create))
+                {
+                    blobs = WriteContainer(container, stream);
+                }
+
+                if (File.Exists(path))
+                {
+                    File.Delete(path);
+                }
+
+                File.Move(tempPath, path);
+
+                // blobs that were read from the replaced file now refer to their copy in the new one
+                string fullPath = Path.GetFullPath(path);
+
+                for (int i = 0; i < blobs.Blobs.Count; i++)
+                {
+                    if (blobs.Blobs[i].SourcePath == fullPath)
+                    {
+                        blobs.Blobs[i].Attach(fullPath, blobs.Start + blobs.Offsets[i], blobs.Blobs[i].Length);
+                    }
+                }
+
+                return true;
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError(ex.ToString());
+
+                try
+                {
+                    File.Delete(tempPath);
+                }
+                catch (Exception)
+                {
+                }
+
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Deserializes container from <paramref name="path"/>
+        /// </summary>
+        /// <param name="path">file to deserialize from</param>
+        /// <param name="keys">top level keys to load, all are loaded if null or empty</param>
+        /// <returns>Deserialized container, null if reading failed</returns>
+        public static IDataContainer DeserializeFromFile(string path, ICollection<string> keys = null)
+        {
+            try
+            {
+                using (var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read))
+                {
+                    return Read(stream, keys, Path.GetFullPath(path));
+                }
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError($"Error reading file :{path}, {ex}");
+
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Writes <paramref name="container"/> to a seekable <paramref name="stream"/>
+        /// </summary>
+        /// <param name="container"></param>
+        /// <param name="stream"></param>
+        public static void Write(IDataContainer container, Stream stream)
+        {
+            WriteContainer(container, stream);
+        }
+
+        private static BlobSection WriteContainer(IDataContainer container, Stream stream)
+        {
+            var dictionary = new KeyDictionary();
+            var blobs = new BlobSection();
+            var blocks = new List<Block>();
+            var raw = new MemoryStream();
+            var rawWriter = new BinaryWriter(raw, Encoding.UTF8);
+            var block = new Block();
+
+            foreach (var obj in container)
+            {
+                block.Keys.Add(dictionary.Key(obj.Name));
+
+                WriteRecord(rawWriter, obj, dictionary, blobs);
+
+                if (raw.Length >= BlockSize)
+                {
+                    blocks.Add(Compress(block, raw));
+                    block = new Block();
+                }
+            }
+
+            if (block.Keys.Count > 0)
+            {
+                blocks.Add(Compress(block, raw));
+            }
+
+            var writer = new BinaryWriter(stream, Encoding.UTF8);
+
+            writer.Write(Magic);
+            writer.Write(Version);
+            writer.Write(container is IPropertyContainer ? PropertyContainerRoot : DataContainerRoot);
+            writer.Write(container.Name ?? string.Empty);
+            writer.Write(container.UnderlyingType is TypeInfo t ? XmlHelper.SerializeToString(t) : string.Empty);
+
+            WriteStrings(writer, dictionary.Keys);
+            WriteStrings(writer, dictionary.Types);
+
+            WriteCount(writer, blocks.Count);
+
+            long offset = 0;
+
+            foreach (var b in blocks)
+            {
+                writer.Write(offset);
+                writer.Write(b.Data.Length);
+                writer.Write(b.RawLength);
+                WriteCount(writer, b.Keys.Count);
+
+                foreach (var key in b.Keys)
+                {
+                    WriteCount(writer, key);
+                }
+
+                offset += b.Data.Length;
+            }
+
+            foreach (var b in blocks)
+            {
+                writer.Write(b.Data);
+            }
+
+            writer.Flush();
+
+            blobs.Start = stream.Position;
+
+            foreach (var blob in blobs.Blobs)
+            {
+                blob.CopyTo(stream);
+            }
+
+            return blobs;
+        }
+
+        /// <summary>
+        /// Reads container from a seekable <paramref name="stream"/>, blobs are read in to memory
+        /// </summary>
+        /// <param name="stream"></param>
+        /// <param name="keys">top level keys to load, all are loaded if null or empty</param>
+        /// <returns></returns>
+        public static IDataContainer Read(Stream stream, ICollection<string> keys = null)
+        {
+            return Read(stream, keys, null);
+        }
+
+        /// <summary>
+        /// Reads container from <paramref name="stream"/>, if <paramref name="blobPath"/> is given blobs are read from that file on demand.
+        /// Only the user's own file is used for that, any other file like a cache image may be replaced while blobs are still alive.
+        /// </summary>
+        private static IDataContainer Read(Stream stream, ICollection<string> keys, string blobPath)
+        {
+            var reader = new BinaryReader(stream, Encoding.UTF8);
+
+            var magic = reader.ReadBytes(Magic.Length);
+
+            for (int i = 0; i < Magic.Length; i++)
+            {
+                if (magic.Length != Magic.Length || magic[i] != Magic[i])
+                {
+                    throw new InvalidDataException("Not a compressed DataContainer file");
+                }
+            }
+
+            byte version = reader.ReadByte();
+
+            if (version == 0 || version > Version)
+            {
+                throw new InvalidDataException("Unsupported compressed DataContainer version");
+            }
+
+            bool isProperty = reader.ReadByte() == PropertyContainerRoot;
+            IDataContainer container = isProperty ? new PropertyContainer() : (IDataContainer)new DataContainer();
+
+            container.Name = reader.ReadString();
+
+            if (reader.ReadString() is string typeXml && typeXml.Length > 0)
+            {
+                container.UnderlyingType = XmlHelper.DeserializeFromString<TypeInfo>(typeXml);
+            }
+
+            var dictionary = new KeyDictionary(ReadStrings(reader), ReadStrings(reader));
+
+            int blockCount = ReadCount(reader);
+            var blocks = new List<Block>(blockCount);
+
+            for (int i = 0; i < blockCount; i++)
+            {
+                var block = new Block
+                {
+                    Offset = reader.ReadInt64(),
+                    Length = reader.ReadInt32(),
+                    RawLength = reader.ReadInt32()
+                };
+
+                int count = ReadCount(reader);
+
+                for (int j = 0; j < count; j++)
+                {
+                    block.Keys.Add(ReadCount(reader));
+                }
+
+                blocks.Add(block);
+            }
+
+            long dataStart = stream.Position;
+            long blobStart = dataStart;
+
+            foreach (var block in blocks)
+            {
+                blobStart += block.Length;
+            }
+
+            var blobs = new BlobSection
+            {
+                Path = blobPath,
+                Stream = stream,
+                Start = blobStart
+            };
+
+            bool loadAll = keys is null || keys.Count == 0;
+
+            foreach (var block in blocks)
+            {
+                if (loadAll == false && block.Keys.Exists(k => keys.Contains(dictionary.Keys[k])) == false)
+                {
+                    continue;
+                }
+
+                stream.Position = dataStart + block.Offset;
+
+                var blockReader = new BinaryReader(Decompress(reader.ReadBytes(block.Length), block.RawLength), Encoding.UTF8);
+
+                foreach (var key in block.Keys)
+                {
+                    var obj = ReadRecord(blockReader, dictionary, isProperty, blobs);
+
+                    if (obj != null && (loadAll || keys.Contains(dictionary.Keys[key])))
+                    {
+                        container.Add(obj);
+                    }
+                }
+            }
+
+            return container;
+        }
+
+        private static void WriteRecord(BinaryWriter writer, DataObject obj, KeyDictionary dictionary, BlobSection blobs)
+        {
+            WriteCount(writer, dictionary.Key(obj.Name));
+            WriteCount(writer, dictionary.Type(obj.Type));
+
+            if (obj is ContainerDataObject cdo
+                && cdo.ObjectType is null
+                && cdo.GetValue() is DataContainer dc
+                && dc.GetType() == typeof(DataContainer)
+                && dc.UnderlyingType is null)
+            {
+                writer.Write(ContainerRecord);
+                WriteCount(writer, dc.Count);
+
+                foreach (var child in dc)
+                {
+                    WriteRecord(writer, child, dictionary, blobs);
+                }
+            }
+            else if (DataObjectFactory.IsDefaultDataObject(obj) && obj.GetValue() is Blob blob)
+            {
+                writer.Write(BlobRecord);
+                writer.Write(blobs.Add(blob));
+                writer.Write(blob.Length);
+            }
+            else if (DataObjectFactory.IsDefaultDataObject(obj) && CanWriteValue(obj.Type))
+            {
+                writer.Write(ValueRecord);
+                WriteValue(writer, obj.Type, obj.GetValue());
+            }
+            else
+            {
+                var settings = new XmlWriterSettings
+                {
+                    OmitXmlDeclaration = true,
+                    ConformanceLevel = ConformanceLevel.Fragment
+                };
+
+                using (var stringWriter = new StringWriter())
+                {
+                    using (var xmlWriter = XmlWriter.Create(stringWriter, settings))
+                    {
+                        obj.WriteXml(xmlWriter);
+                    }
+
+                    writer.Write(XmlRecord);
+                    writer.Write(stringWriter.ToString());
+                }
+            }
+        }
+
+        private static DataObject ReadRecord(BinaryReader reader, KeyDictionary dictionary, bool isProperty, BlobSection blobs)
+        {
+            string key = dictionary.Keys[ReadCount(reader)];
+            string type = dictionary.Types[ReadCount(reader)];
+
+            switch (reader.ReadByte())
+            {
+                case ContainerRecord:
+                {
+                    var dc = new DataContainer { Name = key };
+                    int count = ReadCount(reader);
+
+                    for (int i = 0; i < count; i++)
+                    {
+                        if (ReadRecord(reader, dictionary, false, blobs) is DataObject child)
+                        {
+                            dc.Add(child);
+                        }
+                    }
+
+                    return new ContainerDataObject(key, dc);
+                }
+
+                case ValueRecord:
+                    return DataObjectFactory.GetDataObject(type, key, ReadValue(reader, type));
+
+                case BlobRecord:
+                {
+                    long offset = reader.ReadInt64();
+                    long length = reader.ReadInt64();
+
+                    return DataObjectFactory.GetDataObject(type, key, blobs.Get(offset, length));
+                }
+
+                case XmlRecord:
+                {
+                    var obj = isProperty ? DataObjectFactory.GetPropertyObject(type) : DataObjectFactory.GetDataObject(type);
+
+                    using (var xmlReader = XmlReader.Create(new StringReader(reader.ReadString())))
+                    {
+                        xmlReader.Read();
+
+                        obj.ReadXml(xmlReader);
+                    }
+
+                    return obj.Type != DataObjectType.NotSupported ? obj : null;
+                }
+
+                default:
+                    throw new InvalidDataException($"Invalid record for \"{key}\"");
+            }
+        }
+
+        private static bool CanWriteValue(string type)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean:
+                case DataObjectType.Byte:
+                case DataObjectType.Char:
+                case DataObjectType.Short:
+                case DataObjectType.Integer:
+                case DataObjectType.Long:
+                case DataObjectType.UShort:
+                case DataObjectType.UInteger:
+                case DataObjectType.ULong:
+                case DataObjectType.Float:
+                case DataObjectType.Double:
+                case DataObjectType.String:
+                case DataObjectType.DateTime:
+                case DataObjectType.TimeSpan:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        private static void WriteValue(BinaryWriter writer, string type, object value)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean: writer.Write((bool)value); break;
+                case DataObjectType.Byte: writer.Write((byte)value); break;
+                case DataObjectType.Char: writer.Write((ushort)(char)value); break;
+                case DataObjectType.Short: writer.Write((short)value); break;
+                case DataObjectType.Integer: writer.Write((int)value); break;
+                case DataObjectType.Long: writer.Write((long)value); break;
+                case DataObjectType.UShort: writer.Write((ushort)value); break;
+                case DataObjectType.UInteger: writer.Write((uint)value); break;
+                case DataObjectType.ULong: writer.Write((ulong)value); break;
+                case DataObjectType.Float: writer.Write((float)value); break;
+                case DataObjectType.Double: writer.Write((double)value); break;
+                case DataObjectType.DateTime: writer.Write(((DateTime)value).ToBinary()); break;
+                case DataObjectType.TimeSpan: writer.Write(((TimeSpan)value).Ticks); break;
+                case DataObjectType.String:
+                    writer.Write(value is string);
+                    if (value is string s)
+                    {
+                        writer.Write(s);
+                    }
+                    break;
+            }
+        }
+
+        private static object ReadValue(BinaryReader reader, string type)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean: return reader.ReadBoolean();
+                case DataObjectType.Byte: return reader.ReadByte();
+                case DataObjectType.Char: return (char)reader.ReadUInt16();
+                case DataObjectType.Short: return reader.ReadInt16();
+                case DataObjectType.Integer: return reader.ReadInt32();
+                case DataObjectType.Long: return reader.ReadInt64();
+                case DataObjectType.UShort: return reader.ReadUInt16();
+                case DataObjectType.UInteger: return reader.ReadUInt32();
+                case DataObjectType.ULong: return reader.ReadUInt64();
+                case DataObjectType.Float: return reader.ReadSingle();
+                case DataObjectType.Double: return reader.ReadDouble();
+                case DataObjectType.DateTime: return DateTime.FromBinary(reader.ReadInt64());
+                case DataObjectType.TimeSpan: return new TimeSpan(reader.ReadInt64());
+                case DataObjectType.String: return reader.ReadBoolean() ? reader.ReadString() : null;
+                default:
+                    throw new InvalidDataException($"Invalid value type \"{type}\"");
+            }
+        }
+
+        private static Block Compress(Block block, MemoryStream raw)
+        {
+            using (var compressed = new MemoryStream())
+            {
+                using (var deflate = new DeflateStream(compressed, CompressionLevel.Fastest, true))
+                {
+                    raw.WriteTo(deflate);
+                }
+
+                block.RawLength = (int)raw.Length;
+                block.Data = compressed.ToArray();
+            }
+
+            raw.SetLength(0);
+
+            return block;
+        }
+
+        private static MemoryStream Decompress(byte[] data, int rawLength)
+        {
+            var raw = new MemoryStream(rawLength);
+
+            using (var deflate = new DeflateStream(new MemoryStream(data), CompressionMode.Decompress))
+            {
+                deflate.CopyTo(raw);
+            }
+
+            raw.Position = 0;
+
+            return raw;
+        }
+
+        private static void WriteStrings(BinaryWriter writer, List<string> strings)
+        {
+            WriteCount(writer, strings.Count);
+
+            foreach (var s in strings)
+            {
+                writer.Write(s ?? string.Empty);
+            }
+        }
+
+        private static List<string> ReadStrings(BinaryReader reader)
+        {
+            int count = ReadCount(reader);
+            var strings = new List<string>(count);
+
+            for (int i = 0; i < count; i++)
+            {
+                strings.Add(reader.ReadString());
+            }
+
+            return strings;
+        }
+
+        /// <summary>
+        /// Writes <paramref name="value"/> as 7 bit encoded integer, most indices fit in one byte
+        /// </summary>
+        private static void WriteCount(BinaryWriter writer, int value)
+        {
+            uint v = (uint)value;
+
+            while (v >= 0x80)
+            {
+                writer.Write((byte)(v | 0x80));
+                v >>= 7;
+            }
+
+            writer.Write((byte)v);
+        }
+
+        private static int ReadCount(BinaryReader reader)
+        {
+            int value = 0;
+            int shift = 0;
+            byte b;
+
+            do
+            {
+                b = reader.ReadByte();
+                value |= (b & 0x7F) << shift;
+                shift += 7;
+            }
+            while ((b & 0x80) != 0);
+
+            return value;
+        }
+
+        /// <summary>
+        /// Key names and type ids of a file, each stored once
+        /// </summary>
+        private class KeyDictionary
+        {
+            private readonly Dictionary<string, int> keyIndices = new Dictionary<string, int>();
+            private readonly Dictionary<string, int> typeIndices = new Dictionary<string, int>();
+
+            public KeyDictionary() : this(new List<string>(), new List<string>()) { }
+
+            public KeyDictionary(List<string> keys, List<string> types)
+            {
+                Keys = keys;
+                Types = types;
+            }
+
+            public List<string> Keys { get; }
+
+            public List<string> Types { get; }
+
+            public int Key(string key) => IndexOf(keyIndices, Keys, key ?? string.Empty);
+
+            public int Type(string type) => IndexOf(typeIndices, Types, type);
+
+            private static int IndexOf(Dictionary<string, int> indices, List<string> values, string value)
+            {
+                if (indices.TryGetValue(value, out int index) == false)
+                {
+                    index = values.Count;
+                    indices.Add(value, index);
+                    values.Add(value);
+                }
+
+                return index;
+            }
+        }
+
+        /// <summary>
+        /// Blobs of a file, offsets are relative to <see cref="Start"/>
+        /// </summary>
+        private class BlobSection
+        {
+            public List<Blob> Blobs { get; } = new List<Blob>();
+            public List<long> Offsets { get; } = new List<long>();
+            public long Length { get; private set; }
+            public long Start { get; set; }
+
+            /// <summary>
+            /// File being read, blobs are read from it on demand
+            /// </summary>
+            public string Path { get; set; }
+
+            /// <summary>
+            /// Stream being read, used when it's not a file
+            /// </summary>
+            public Stream Stream { get; set; }
+
+            public long Add(Blob blob)
+            {
+                long offset = Length;
+
+                Blobs.Add(blob);
+                Offsets.Add(offset);
+                Length += blob.Length;
+
+                return offset;
+            }
+
+            public Blob Get(long offset, long length)
+            {
+                if (Path != null)
+                {
+                    return new Blob(Path, Start + offset, length);
+                }
+
+                var data = new byte[length];
+                int read = 0;
+
+                Stream.Position = Start + offset;
+
+                while (read < data.Length)
+                {
+                    int n = Stream.Read(data, read, data.Length - read);
+
+                    if (n == 0)
+                    {
+                        throw new EndOfStreamException("Blob content is truncated");
+                    }
+
+                    read += n;
+                }
+
+                return new Blob(data);
+            }
+        }
+
+        private class Block
+        {
+            public List<int> Keys { get; } = new List<int>();
+            public long Offset { get; set; }
+            public int Length { get; set; }
+            public int RawLength { get; set; }
+            public byte[] Data { get; set; }
+        }
+    }
+}
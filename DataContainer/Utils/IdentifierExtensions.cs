@@ -1,4 +1,5 @@
 ﻿using System.Collections.Generic;
+using System.Text;
 using System.Text.RegularExpressions;
 
 namespace System.Configuration.Utils
@@ -75,5 +76,33 @@ namespace System.Configuration.Utils
             // 3. it's not a valid identifier
             return false;
         }
+
+        /// <summary>
+        /// Makes a valid identifier out of <paramref name="name"/> by replacing invalid characters with '_'
+        /// and prefixing '_' if it does not start with a letter or '_'
+        /// </summary>
+        /// <param name="name"></param>
+        /// <returns></returns>
+        public static string ToValidIdentifier(this string name)
+        {
+            if (IsValidIdentifier(name))
+            {
+                return name;
+            }
+
+            var builder = new StringBuilder(name.Length + 1);
+
+            foreach (char c in name)
+            {
+                builder.Append(char.IsLetterOrDigit(c) || c == '_' ? c : '_');
+            }
+
+            if (builder.Length == 0 || (char.IsLetter(builder[0]) == false && builder[0] != '_') || _keywords.Contains(builder.ToString()))
+            {
+                builder.Insert(0, '_');
+            }
+
+            return builder.ToString();
+        }
     }
 }
@@ -0,0 +1,640 @@
+﻿using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Text.Json;
+using System.Xml;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Reads and writes <see cref="IDataContainer"/> as JSON.
+    ///
+    /// Containers are JSON objects and values are written as plain JSON values, so files can be used by any JSON tool.
+    /// Strings, booleans, integers that fit in <see cref="int"/> and doubles with a fraction are recognized from the JSON value,
+    /// for other types the type id of each key is written in a "$types" member before the values, so loading is lossless.
+    /// Values that have no JSON form, and <see cref="PropertyObject"/>s with their metadata, are written as their XML fragment in a "$xml" member.
+    ///
+    /// Writing goes straight to the output in one pass and reading builds the container from the token stream,
+    /// neither creates a DOM.
+    /// </summary>
+    public static class JsonHelper
+    {
+        private const string TypesMember = "$types";
+        private const string NameMember = "$name";
+        private const string PropertyMember = "$property";
+        private const string XmlMember = "$xml";
+        private const string ArraySuffix = "[]";
+
+        /// <summary>
+        /// Element types of arrays that are written as JSON arrays, only arrays of primitives are supported by <see cref="Array1DDataObject"/>
+        /// </summary>
+        private static readonly Dictionary<string, Type> ElementTypes = new Dictionary<string, Type>
+        {
+            { DataObjectType.Boolean, typeof(bool) },
+            { DataObjectType.Byte, typeof(byte) },
+            { DataObjectType.Char, typeof(char) },
+            { DataObjectType.Short, typeof(short) },
+            { DataObjectType.Integer, typeof(int) },
+            { DataObjectType.Long, typeof(long) },
+            { DataObjectType.UShort, typeof(ushort) },
+            { DataObjectType.UInteger, typeof(uint) },
+            { DataObjectType.ULong, typeof(ulong) },
+            { DataObjectType.Float, typeof(float) },
+            { DataObjectType.Double, typeof(double) },
+        };
+
+        /// <summary>
+        /// Serializes <paramref name="container"/> to <paramref name="path"/>
+        /// </summary>
+        /// <param name="container">container to serialize</param>
+        /// <param name="path">file path to serialize to</param>
+        /// <returns>Is success</returns>
+        public static bool SerializeToFile(IDataContainer container, string path)
+        {
+            try
+            {
+                using (var stream = new FileStream(path, FileMode.Create))
+                {
+                    Write(container, stream);
+                }
+
+                return true;
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError(ex.ToString());
+
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Deserializes container from <paramref name="path"/>
+        /// </summary>
+        /// <param name="path">file to deserialize from</param>
+        /// <returns>Deserialized container, null if reading failed</returns>
+        public static IDataContainer DeserializeFromFile(string path)
+        {
+            try
+            {
+                return Read(File.ReadAllBytes(path));
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError($"Error reading file :{path}, {ex}");
+
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Writes <paramref name="container"/> to <paramref name="stream"/> as UTF-8 JSON
+        /// </summary>
+        /// <param name="container"></param>
+        /// <param name="stream"></param>
+        public static void Write(IDataContainer container, Stream stream)
+        {
+            using (var writer = new Utf8JsonWriter(stream, new JsonWriterOptions { Indented = true }))
+            {
+                writer.WriteStartObject();
+
+                if (container is IPropertyContainer)
+                {
+                    writer.WriteBoolean(PropertyMember, true);
+                }
+
+                if (string.IsNullOrEmpty(container.Name) == false)
+                {
+                    writer.WriteString(NameMember, container.Name);
+                }
+
+                WriteMembers(writer, container);
+                writer.WriteEndObject();
+            }
+        }
+
+        /// <summary>
+        /// Reads container from UTF-8 <paramref name="json"/>
+        /// </summary>
+        /// <param name="json"></param>
+        /// <returns></returns>
+        public static IDataContainer Read(byte[] json)
+        {
+            var reader = new Utf8JsonReader(json, new JsonReaderOptions
+            {
+                CommentHandling = JsonCommentHandling.Skip,
+                AllowTrailingCommas = true
+            });
+
+            reader.Read();
+            Expect(ref reader, JsonTokenType.StartObject);
+
+            bool isProperty = IsPropertyContainer(reader);
+            var dc = isProperty ? new PropertyContainer() : (DataContainerBase)new DataContainer();
+            ReadMembers(ref reader, dc, isProperty);
+
+            return dc;
+        }
+
+        #region Writing
+
+        private static void WriteMembers(Utf8JsonWriter writer, IDataContainer container)
+        {
+            bool hasTypes = false;
+
+            foreach (var obj in container)
+            {
+                if (GetTypeHint(obj) is string type)
+                {
+                    if (hasTypes == false)
+                    {
+                        writer.WriteStartObject(TypesMember);
+                        hasTypes = true;
+                    }
+
+                    writer.WriteString(obj.Name, type);
+                }
+            }
+
+            if (hasTypes)
+            {
+                writer.WriteEndObject();
+            }
+
+            foreach (var obj in container)
+            {
+                writer.WritePropertyName(obj.Name);
+
+                if (IsPlainContainer(obj, out IDataContainer dc))
+                {
+                    writer.WriteStartObject();
+                    WriteMembers(writer, dc);
+                    writer.WriteEndObject();
+                }
+                else if (IsValue(obj))
+                {
+                    WriteValue(writer, obj.Type, obj.GetValue());
+                }
+                else if (IsArray(obj, out string elementType))
+                {
+                    writer.WriteStartArray();
+
+                    foreach (var item in (Array)obj.GetValue())
+                    {
+                        WriteValue(writer, elementType, item);
+                    }
+
+                    writer.WriteEndArray();
+                }
+                else
+                {
+                    writer.WriteStartObject();
+                    writer.WriteString(XmlMember, ToXml(obj));
+                    writer.WriteEndObject();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Type id to write in "$types" for <paramref name="obj"/>, null if it's recognized from the JSON value
+        /// </summary>
+        private static string GetTypeHint(DataObject obj)
+        {
+            if (IsPlainContainer(obj, out _))
+            {
+                return null;
+            }
+
+            if (IsValue(obj) == false)
+            {
+                return IsArray(obj, out string elementType) ? elementType + ArraySuffix : obj.Type;
+            }
+
+            switch (obj.Type)
+            {
+                case DataObjectType.Boolean:
+                case DataObjectType.String:
+                case DataObjectType.Integer:
+                    return null;
+
+                case DataObjectType.Double:
+                    // integral values are written without a fraction and NaN and infinity as strings
+                    double d = (double)obj.GetValue();
+                    return double.IsNaN(d) || double.IsInfinity(d) || Math.Floor(d) == d ? obj.Type : null;
+
+                default:
+                    return obj.Type;
+            }
+        }
+
+        private static bool IsPlainContainer(DataObject obj, out IDataContainer dc)
+        {
+            dc = obj.Type == DataObjectType.Container && DataObjectFactory.IsDefaultDataObject(obj)
+                ? obj.GetValue() as IDataContainer
+                : null;
+
+            return dc != null && dc.UnderlyingType is null;
+        }
+
+        private static bool IsValue(DataObject obj)
+        {
+            return DataObjectFactory.IsDefaultDataObject(obj) && CanWriteValue(obj.Type);
+        }
+
+        /// <summary>
+        /// Checks if <paramref name="obj"/> is an array of values that can be written as JSON array
+        /// </summary>
+        private static bool IsArray(DataObject obj, out string elementType)
+        {
+            elementType = null;
+
+            if (obj.Type != DataObjectType.Array1D || DataObjectFactory.IsDefaultDataObject(obj) == false)
+            {
+                return false;
+            }
+
+            Type type = obj.GetDataType().GetElementType();
+
+            foreach (var entry in ElementTypes)
+            {
+                if (entry.Value == type)
+                {
+                    elementType = entry.Key;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        private static bool CanWriteValue(string type)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean:
+                case DataObjectType.Byte:
+                case DataObjectType.Char:
+                case DataObjectType.Short:
+                case DataObjectType.Integer:
+                case DataObjectType.Long:
+                case DataObjectType.UShort:
+                case DataObjectType.UInteger:
+                case DataObjectType.ULong:
+                case DataObjectType.Float:
+                case DataObjectType.Double:
+                case DataObjectType.String:
+                case DataObjectType.DateTime:
+                case DataObjectType.TimeSpan:
+                case DataObjectType.Color:
+                case DataObjectType.Point:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        private static void WriteValue(Utf8JsonWriter writer, string type, object value)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean: writer.WriteBooleanValue((bool)value); break;
+                case DataObjectType.Byte: writer.WriteNumberValue((byte)value); break;
+                case DataObjectType.Char: writer.WriteStringValue(((char)value).ToString()); break;
+                case DataObjectType.Short: writer.WriteNumberValue((short)value); break;
+                case DataObjectType.Integer: writer.WriteNumberValue((int)value); break;
+                case DataObjectType.Long: writer.WriteNumberValue((long)value); break;
+                case DataObjectType.UShort: writer.WriteNumberValue((ushort)value); break;
+                case DataObjectType.UInteger: writer.WriteNumberValue((uint)value); break;
+                case DataObjectType.ULong: writer.WriteNumberValue((ulong)value); break;
+                case DataObjectType.Float:
+                    float f = (float)value;
+                    if (float.IsNaN(f) || float.IsInfinity(f))
+                    {
+                        writer.WriteStringValue(f.ToString(CultureInfo.InvariantCulture));
+                    }
+                    else
+                    {
+                        writer.WriteNumberValue(f);
+                    }
+                    break;
+                case DataObjectType.Double:
+                    double d = (double)value;
+                    if (double.IsNaN(d) || double.IsInfinity(d))
+                    {
+                        writer.WriteStringValue(d.ToString(CultureInfo.InvariantCulture));
+                    }
+                    else
+                    {
+                        writer.WriteNumberValue(d);
+                    }
+                    break;
+                case DataObjectType.String:
+                    if (value is string s)
+                    {
+                        writer.WriteStringValue(s);
+                    }
+                    else
+                    {
+                        writer.WriteNullValue();
+                    }
+                    break;
+                case DataObjectType.DateTime: writer.WriteStringValue((DateTime)value); break;
+                case DataObjectType.TimeSpan: writer.WriteStringValue(((TimeSpan)value).ToString("c", CultureInfo.InvariantCulture)); break;
+                case DataObjectType.Color: writer.WriteStringValue(((Color)value).ToString()); break;
+                case DataObjectType.Point:
+                    var p = (Point)value;
+                    writer.WriteStartObject();
+                    writer.WriteNumber(nameof(Point.X), p.X);
+                    writer.WriteNumber(nameof(Point.Y), p.Y);
+                    writer.WriteEndObject();
+                    break;
+            }
+        }
+
+        private static string ToXml(DataObject obj)
+        {
+            var settings = new XmlWriterSettings
+            {
+                OmitXmlDeclaration = true,
+                ConformanceLevel = ConformanceLevel.Fragment
+            };
+
+            using (var stringWriter = new StringWriter())
+            {
+                using (var xmlWriter = XmlWriter.Create(stringWriter, settings))
+                {
+                    obj.WriteXml(xmlWriter);
+                }
+
+                return stringWriter.ToString();
+            }
+        }
+
+        #endregion
+
+        #region Reading
+
+        /// <summary>
+        /// Checks if the object <paramref name="reader"/> is on starts with "$property",
+        /// reader is passed by value so it's not advanced.
+        /// </summary>
+        private static bool IsPropertyContainer(Utf8JsonReader reader)
+        {
+            return reader.Read()
+                && reader.TokenType == JsonTokenType.PropertyName
+                && reader.ValueTextEquals(PropertyMember)
+                && reader.Read()
+                && reader.TokenType == JsonTokenType.True;
+        }
+
+        /// <summary>
+        /// Reads members of object <paramref name="reader"/> is on in to <paramref name="dc"/>,
+        /// leaves reader on end of the object.
+        /// </summary>
+        private static void ReadMembers(ref Utf8JsonReader reader, DataContainerBase dc, bool isProperty)
+        {
+            Dictionary<string, string> types = null;
+
+            while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+            {
+                string key = reader.GetString();
+                reader.Read();
+
+                if (key == TypesMember)
+                {
+                    types = ReadTypes(ref reader);
+                }
+                else if (key == NameMember)
+                {
+                    dc.Name = reader.GetString();
+                }
+                else if (key != PropertyMember)
+                {
+                    string type = null;
+                    types?.TryGetValue(key, out type);
+
+                    if (ReadDataObject(ref reader, key, type, isProperty) is DataObject obj)
+                    {
+                        dc.Add(obj);
+                    }
+                }
+            }
+
+            Expect(ref reader, JsonTokenType.EndObject);
+        }
+
+        private static Dictionary<string, string> ReadTypes(ref Utf8JsonReader reader)
+        {
+            Expect(ref reader, JsonTokenType.StartObject);
+
+            var types = new Dictionary<string, string>();
+
+            while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+            {
+                string key = reader.GetString();
+                reader.Read();
+                types[key] = reader.GetString();
+            }
+
+            Expect(ref reader, JsonTokenType.EndObject);
+
+            return types;
+        }
+
+        private static DataObject ReadDataObject(ref Utf8JsonReader reader, string key, string type, bool isProperty)
+        {
+            switch (reader.TokenType)
+            {
+                case JsonTokenType.StartObject when type is null:
+                {
+                    var child = new DataContainer { Name = key };
+                    ReadMembers(ref reader, child, false);
+
+                    return new ContainerDataObject(key, child);
+                }
+
+                case JsonTokenType.StartObject when type != DataObjectType.Point:
+                    return ReadXml(ref reader, type, isProperty);
+
+                case JsonTokenType.StartArray:
+                {
+                    string elementType = type != null && type.EndsWith(ArraySuffix)
+                        ? type.Substring(0, type.Length - ArraySuffix.Length)
+                        : null;
+
+                    return ReadArray(ref reader, elementType) is Array array ? new Array1DDataObject(key, array) : null;
+                }
+
+                default:
+                    type = type ?? InferType(ref reader);
+
+                    return DataObjectFactory.GetDataObject(type, key, ReadValue(ref reader, type));
+            }
+        }
+
+        private static DataObject ReadXml(ref Utf8JsonReader reader, string type, bool isProperty)
+        {
+            string xml = null;
+
+            while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+            {
+                string member = reader.GetString();
+                reader.Read();
+
+                if (member == XmlMember)
+                {
+                    xml = reader.GetString();
+                }
+                else
+                {
+                    reader.Skip();
+                }
+            }
+
+            Expect(ref reader, JsonTokenType.EndObject);
+
+            if (xml is null)
+            {
+                return null;
+            }
+
+            var obj = isProperty ? DataObjectFactory.GetPropertyObject(type) : DataObjectFactory.GetDataObject(type);
+
+            using (var xmlReader = XmlReader.Create(new StringReader(xml)))
+            {
+                xmlReader.Read();
+
+                obj.ReadXml(xmlReader);
+            }
+
+            return obj.Type != DataObjectType.NotSupported ? obj : null;
+        }
+
+        /// <summary>
+        /// Reads array, element type is taken from the first element if <paramref name="elementType"/> is null.
+        /// Returns null if elements are not of a supported type.
+        /// </summary>
+        private static Array ReadArray(ref Utf8JsonReader reader, string elementType)
+        {
+            var values = new List<object>();
+
+            while (reader.Read() && reader.TokenType != JsonTokenType.EndArray)
+            {
+                if (elementType is null)
+                {
+                    elementType = InferType(ref reader);
+                }
+
+                values.Add(ReadValue(ref reader, elementType));
+            }
+
+            if (ElementTypes.TryGetValue(elementType ?? DataObjectType.Integer, out Type type) == false)
+            {
+                return null;
+            }
+
+            Array array = Array.CreateInstance(type, values.Count);
+
+            for (int i = 0; i < values.Count; i++)
+            {
+                array.SetValue(values[i], i);
+            }
+
+            return array;
+        }
+
+        /// <summary>
+        /// Type id for a value without an entry in "$types"
+        /// </summary>
+        private static string InferType(ref Utf8JsonReader reader)
+        {
+            switch (reader.TokenType)
+            {
+                case JsonTokenType.True:
+                case JsonTokenType.False:
+                    return DataObjectType.Boolean;
+
+                case JsonTokenType.Number:
+                    return reader.TryGetInt32(out _) ? DataObjectType.Integer
+                        : reader.TryGetInt64(out _) ? DataObjectType.Long
+                        : DataObjectType.Double;
+
+                case JsonTokenType.String:
+                case JsonTokenType.Null:
+                    return DataObjectType.String;
+
+                default:
+                    throw new JsonException($"Unexpected {reader.TokenType} at {reader.TokenStartIndex}");
+            }
+        }
+
+        private static object ReadValue(ref Utf8JsonReader reader, string type)
+        {
+            switch (type)
+            {
+                case DataObjectType.Boolean: return reader.GetBoolean();
+                case DataObjectType.Byte: return reader.GetByte();
+                case DataObjectType.Char: return reader.GetString()[0];
+                case DataObjectType.Short: return reader.GetInt16();
+                case DataObjectType.Integer: return reader.GetInt32();
+                case DataObjectType.Long: return reader.GetInt64();
+                case DataObjectType.UShort: return reader.GetUInt16();
+                case DataObjectType.UInteger: return reader.GetUInt32();
+                case DataObjectType.ULong: return reader.GetUInt64();
+                case DataObjectType.Float:
+                    return reader.TokenType == JsonTokenType.String
+                        ? float.Parse(reader.GetString(), CultureInfo.InvariantCulture)
+                        : reader.GetSingle();
+                case DataObjectType.Double:
+                    return reader.TokenType == JsonTokenType.String
+                        ? double.Parse(reader.GetString(), CultureInfo.InvariantCulture)
+                        : reader.GetDouble();
+                case DataObjectType.String: return reader.GetString();
+                case DataObjectType.DateTime: return reader.GetDateTime();
+                case DataObjectType.TimeSpan: return TimeSpan.ParseExact(reader.GetString(), "c", CultureInfo.InvariantCulture);
+                case DataObjectType.Color: return new Color(reader.GetString());
+                case DataObjectType.Point:
+                {
+                    Expect(ref reader, JsonTokenType.StartObject);
+
+                    var p = new Point();
+
+                    while (reader.Read() && reader.TokenType == JsonTokenType.PropertyName)
+                    {
+                        string member = reader.GetString();
+                        reader.Read();
+
+                        if (member == nameof(Point.X))
+                        {
+                            p.X = reader.GetDouble();
+                        }
+                        else if (member == nameof(Point.Y))
+                        {
+                            p.Y = reader.GetDouble();
+                        }
+                        else
+                        {
+                            reader.Skip();
+                        }
+                    }
+
+                    Expect(ref reader, JsonTokenType.EndObject);
+
+                    return p;
+                }
+                default:
+                    throw new JsonException($"Invalid value type \"{type}\" at {reader.TokenStartIndex}");
+            }
+        }
+
+        private static void Expect(ref Utf8JsonReader reader, JsonTokenType type)
+        {
+            if (reader.TokenType != type)
+            {
+                throw new JsonException($"Expected {type} but found {reader.TokenType} at {reader.TokenStartIndex}");
+            }
+        }
+
+        #endregion
+    }
+}
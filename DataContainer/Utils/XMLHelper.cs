@@ -1,4 +1,6 @@
-﻿using System.IO;
+﻿using System.Collections.Concurrent;
+using System.IO;
+using System.Threading.Tasks;
 using System.Xml;
 using System.Xml.Serialization;
 
@@ -6,6 +8,18 @@ namespace System.Configuration
 {
     public static class XmlHelper
     {
+        /// <summary>
+        /// <see cref="XmlSerializer"/> is thread safe and expensive to construct, so keep one per type.
+        /// </summary>
+        private static readonly ConcurrentDictionary<Type, XmlSerializer> serializers = new ConcurrentDictionary<Type, XmlSerializer>();
+
+        /// <summary>
+        /// Gets cached <see cref="XmlSerializer"/> for <paramref name="type"/>
+        /// </summary>
+        /// <param name="type">Type of object</param>
+        /// <returns></returns>
+        public static XmlSerializer GetSerializer(Type type) => serializers.GetOrAdd(type, t => new XmlSerializer(t));
+
         /// <summary>
         /// Serializes Object to file
         /// </summary>
@@ -31,7 +45,7 @@ namespace System.Configuration
 
                 using (var fileStream = new FileStream(filePath, FileMode.Create))
                 {
-                    XmlSerializer serializer = new XmlSerializer(data.GetType());
+                    XmlSerializer serializer = GetSerializer(data.GetType());
                     serializer.Serialize(fileStream, data);
                 }
 
@@ -45,6 +59,52 @@ namespace System.Configuration
             }
         }
 
+        /// <summary>
+        /// Serializes Object to file, serialization happens in memory and
+        /// the file is written asynchronously.
+        /// </summary>
+        /// <param name="data">object to serialize</param>
+        /// <param name="filePath">file path to serialize to</param>
+        /// <returns>Is success</returns>
+        public static async Task<bool> SerializeToFileAsync(object data, string filePath)
+        {
+            try
+            {
+                if (string.IsNullOrEmpty(filePath))
+                {
+                    throw new ArgumentException("Invalid path");
+                }
+
+                var dir = Path.GetDirectoryName(filePath);
+
+                if (string.IsNullOrEmpty(dir) == false && Directory.Exists(dir) == false)
+                {
+                    Directory.CreateDirectory(dir);
+                }
+
+                using (var memoryStream = new MemoryStream())
+                {
+                    XmlSerializer serializer = GetSerializer(data.GetType());
+                    serializer.Serialize(memoryStream, data);
+
+                    memoryStream.Position = 0;
+
+                    using (var fileStream = new FileStream(filePath, FileMode.Create, FileAccess.Write, FileShare.None, 4096, true))
+                    {
+                        await memoryStream.CopyToAsync(fileStream).ConfigureAwait(false);
+                    }
+                }
+
+                return true;
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError(ex.ToString());
+
+                return false;
+            }
+        }
+
         /// <summary>
         /// Serialize object to string
         /// </summary>
@@ -55,7 +115,7 @@ namespace System.Configuration
         {
             try
             {
-                XmlSerializer serializer = new XmlSerializer(data.GetType());
+                XmlSerializer serializer = GetSerializer(data.GetType());
 
                 var settings = new XmlWriterSettings
                 {
@@ -102,7 +162,7 @@ namespace System.Configuration
             {
                 using (var fileStream = new FileStream(filePath, FileMode.Open))
                 {
-                    XmlSerializer serializer = new XmlSerializer(type);
+                    XmlSerializer serializer = GetSerializer(type);
                     object data = serializer.Deserialize(fileStream);
                     return data;
                 }
@@ -115,6 +175,41 @@ namespace System.Configuration
         }
 
 
+        /// <summary>
+        /// Deserialize object from file, file is read asynchronously and
+        /// deserialized from memory.
+        /// </summary>
+        /// <param name="filePath">file to deserialize from</param>
+        /// <param name="type">Type of Object</param>
+        /// <returns>.NET Object</returns>
+        public static async Task<object> DeserializeFromFileAsync(string filePath, Type type)
+        {
+            if (File.Exists(filePath) == false)
+            {
+                return default;
+            }
+            try
+            {
+                using (var memoryStream = new MemoryStream())
+                {
+                    using (var fileStream = new FileStream(filePath, FileMode.Open, FileAccess.Read, FileShare.Read, 4096, true))
+                    {
+                        await fileStream.CopyToAsync(memoryStream).ConfigureAwait(false);
+                    }
+
+                    memoryStream.Position = 0;
+
+                    XmlSerializer serializer = GetSerializer(type);
+                    return serializer.Deserialize(memoryStream);
+                }
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError(ex.ToString());
+                return default;
+            }
+        }
+
         public static T DeserializeFromString<T>(string xml)
         {
             return (T)DeserializeFromString(typeof(T), xml);
@@ -122,7 +217,7 @@ namespace System.Configuration
 
         public static object DeserializeFromString(Type type, string xml)
         {
-            var serializer = new XmlSerializer(type);
+            var serializer = GetSerializer(type);
             using (var reader = new StringReader(xml))
             {
                 return serializer.Deserialize(reader);
@@ -137,13 +232,13 @@ namespace System.Configuration
 
         public static object ReadObjectXml(this XmlReader reader, Type type, bool inplace = true)
         {
-            var s = new XmlSerializer(type);
+            var s = GetSerializer(type);
             return s.Deserialize(inplace ? reader : reader.ReadSubtree());
         }
 
         public static void WriteObjectXml<T>(this XmlWriter writer, T obj)
         {
-            var s = new XmlSerializer(obj.GetType());
+            var s = GetSerializer(obj.GetType());
             s.Serialize(writer, obj, new XmlSerializerNamespaces(new[] { XmlQualifiedName.Empty }));
         }
     }
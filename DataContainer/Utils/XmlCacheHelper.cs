@@ -0,0 +1,151 @@
+﻿using System.IO;
+using System.Linq;
+using System.Security.Cryptography;
+using System.Text;
+
+namespace System.Configuration
+{
+    /// <summary>
+    /// Keeps a pre-parsed image of an XML file next to it, so unchanged files are loaded
+    /// without parsing XML again.
+    ///
+    /// The image is stored in the <see cref="CompressedBinaryHelper"/> format behind a header holding
+    /// the full path, size, last write time and SHA-256 hash of the XML file it was created from,
+    /// it's only used when all of them still match, otherwise the XML file is loaded and the image rewritten.
+    /// </summary>
+    public static class XmlCacheHelper
+    {
+        public const string Extension = ".dcc";
+
+        private static readonly byte[] Magic = Encoding.ASCII.GetBytes("DCC");
+        private const byte Version = 1;
+
+        /// <summary>
+        /// Gets path of the cache file for XML file at <paramref name="path"/>
+        /// </summary>
+        /// <param name="path"></param>
+        /// <returns></returns>
+        public static string GetCachePath(string path) => path + Extension;
+
+        /// <summary>
+        /// Loads XML file at <paramref name="path"/>, from its cache file if that is still valid.
+        /// </summary>
+        /// <param name="path">Path to XML file</param>
+        /// <returns>Deserialized container, null if loading failed</returns>
+        public static IDataContainer DeserializeFromFile(string path)
+        {
+            if (File.Exists(path) == false)
+            {
+                return null;
+            }
+
+            var info = new FileInfo(path);
+            string cachePath = GetCachePath(path);
+            byte[] xml = null;
+
+            try
+            {
+                if (File.Exists(cachePath))
+                {
+                    using (var stream = new FileStream(cachePath, FileMode.Open, FileAccess.Read, FileShare.Read))
+                    {
+                        var reader = new BinaryReader(stream, Encoding.UTF8);
+
+                        if (reader.ReadBytes(Magic.Length).SequenceEqual(Magic)
+                            && reader.ReadByte() == Version
+                            && reader.ReadString() == info.FullName
+                            && reader.ReadInt64() == info.Length
+                            && reader.ReadInt64() == info.LastWriteTimeUtc.Ticks)
+                        {
+                            byte[] hash = reader.ReadBytes(32);
+
+                            // size and time match, make sure the content does too
+                            xml = File.ReadAllBytes(path);
+
+                            if (hash.SequenceEqual(Hash(xml)))
+                            {
+                                return CompressedBinaryHelper.Read(stream);
+                            }
+                        }
+                    }
+                }
+            }
+            catch (Exception)
+            {
+                // invalid cache, fall back to XML
+            }
+
+            try
+            {
+                xml = xml ?? File.ReadAllBytes(path);
+
+                using (var stream = new MemoryStream(xml))
+                {
+                    if (XmlHelper.GetSerializer(typeof(DataContainer)).Deserialize(stream) is DataContainer dc)
+                    {
+                        TrySave(dc, info, Hash(xml), cachePath);
+
+                        return dc;
+                    }
+                }
+            }
+            catch (Exception ex)
+            {
+                DataContainerEvents.NotifyError($"Error reading file :{path}, {ex}");
+            }
+
+            return null;
+        }
+
+        /// <summary>
+        /// Writes cache file, failing to write it is not an error because XML file is still there
+        /// </summary>
+        private static void TrySave(IDataContainer container, FileInfo source, byte[] hash, string cachePath)
+        {
+            string tempPath = cachePath + ".tmp";
+
+            try
+            {
+                using (var stream = new FileStream(tempPath, FileMode.Create))
+                {
+                    var writer = new BinaryWriter(stream, Encoding.UTF8);
+
+                    writer.Write(Magic);
+                    writer.Write(Version);
+                    writer.Write(source.FullName);
+                    writer.Write(source.Length);
+                    writer.Write(source.LastWriteTimeUtc.Ticks);
+                    writer.Write(hash);
+                    writer.Flush();
+
+                    CompressedBinaryHelper.Write(container, stream);
+                }
+
+                if (File.Exists(cachePath))
+                {
+                    File.Delete(cachePath);
+                }
+
+                File.Move(tempPath, cachePath);
+            }
+            catch (Exception)
+            {
+                try
+                {
+                    File.Delete(tempPath);
+                }
+                catch (Exception)
+                {
+                }
+            }
+        }
+
+        private static byte[] Hash(byte[] data)
+        {
+            using (var sha = SHA256.Create())
+            {
+                return sha.ComputeHash(data);
+            }
+        }
+    }
+}